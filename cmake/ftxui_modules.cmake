@@ -20,10 +20,13 @@ target_sources(ftxui-modules
   src/ftxui/component/task.cppm
   src/ftxui/dom.cppm
   src/ftxui/dom/canvas.cppm
+  src/ftxui/dom/data_table.cppm
   src/ftxui/dom/deprecated.cppm
   src/ftxui/dom/direction.cppm
+  src/ftxui/dom/element_arena.cppm
   src/ftxui/dom/elements.cppm
   src/ftxui/dom/flexbox_config.cppm
+  src/ftxui/dom/layout_cache.cppm
   src/ftxui/dom/linear_gradient.cppm
   src/ftxui/dom/node.cppm
   src/ftxui/dom/requirement.cppm
@@ -34,6 +37,7 @@ target_sources(ftxui-modules
   src/ftxui/screen/color.cppm
   src/ftxui/screen/color_info.cppm
   src/ftxui/screen/deprecated.cppm
+  src/ftxui/screen/glyph.cppm
   src/ftxui/screen/image.cppm
   src/ftxui/screen/pixel.cppm
   src/ftxui/screen/screen.cppm
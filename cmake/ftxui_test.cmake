@@ -31,8 +31,10 @@ add_executable(ftxui-tests
   src/ftxui/dom/border_test.cpp
   src/ftxui/dom/canvas_test.cpp
   src/ftxui/dom/color_test.cpp
+  src/ftxui/dom/data_table_test.cpp
   src/ftxui/dom/dbox_test.cpp
   src/ftxui/dom/dim_test.cpp
+  src/ftxui/dom/element_arena_test.cpp
   src/ftxui/dom/flexbox_helper_test.cpp
   src/ftxui/dom/flexbox_test.cpp
   src/ftxui/dom/gauge_test.cpp
@@ -40,16 +42,24 @@ add_executable(ftxui-tests
   src/ftxui/dom/hbox_test.cpp
   src/ftxui/dom/hyperlink_test.cpp
   src/ftxui/dom/italic_test.cpp
+  src/ftxui/dom/layout_cache_test.cpp
   src/ftxui/dom/linear_gradient_test.cpp
+  src/ftxui/dom/node_test.cpp
+  src/ftxui/dom/paragraph_test.cpp
   src/ftxui/dom/scroll_indicator_test.cpp
   src/ftxui/dom/selection_test.cpp
   src/ftxui/dom/separator_test.cpp
   src/ftxui/dom/spinner_test.cpp
+  src/ftxui/dom/style_decorator_test.cpp
   src/ftxui/dom/table_test.cpp
   src/ftxui/dom/text_test.cpp
   src/ftxui/dom/underlined_test.cpp
   src/ftxui/dom/vbox_test.cpp
+  src/ftxui/dom/virtual_list_test.cpp
   src/ftxui/screen/color_test.cpp
+  src/ftxui/screen/glyph_test.cpp
+  src/ftxui/screen/image_test.cpp
+  src/ftxui/screen/screen_test.cpp
   src/ftxui/screen/string_test.cpp
 )
 
@@ -35,6 +35,7 @@ struct Event {
   static Event Mouse(std::string, Mouse mouse);
   static Event CursorPosition(std::string, int x, int y);  // Internal
   static Event CursorShape(std::string, int shape);        // Internal
+  static Event ModeReport(std::string, int mode, int status);  // Internal
 
   // --- Arrow ---
   static const Event ArrowLeft;
@@ -117,6 +118,10 @@ struct Event {
   bool is_cursor_shape() const { return type_ == Type::CursorShape; }
   int cursor_shape() const { return data_.cursor_shape; }
 
+  bool is_mode_report() const { return type_ == Type::ModeReport; }
+  int mode() const { return data_.mode_report.mode; }
+  int mode_status() const { return data_.mode_report.status; }
+
   // Debug
   std::string DebugString() const;
 
@@ -132,6 +137,7 @@ struct Event {
     Mouse,
     CursorPosition,
     CursorShape,
+    ModeReport,
   };
   Type type_ = Type::Unknown;
 
@@ -140,10 +146,16 @@ struct Event {
     int y = 0;
   };
 
+  struct ModeReport {
+    int mode = 0;
+    int status = 0;
+  };
+
   union {
     struct Mouse mouse;
     struct Cursor cursor;
     int cursor_shape;
+    struct ModeReport mode_report;
   } data_ = {};
 
   std::string input_;
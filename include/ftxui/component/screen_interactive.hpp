@@ -5,6 +5,8 @@
 #define FTXUI_COMPONENT_SCREEN_INTERACTIVE_HPP
 
 #include <atomic>                        // for atomic
+#include <cstddef>                       // for size_t
+#include <cstdint>                       // for uint64_t
 #include <ftxui/component/receiver.hpp>  // for Receiver, Sender
 #include <functional>                    // for function
 #include <memory>                        // for shared_ptr
@@ -15,6 +17,8 @@
 #include "ftxui/component/captured_mouse.hpp"  // for CapturedMouse
 #include "ftxui/component/event.hpp"           // for Event
 #include "ftxui/component/task.hpp"            // for Task, Closure
+#include "ftxui/dom/element_arena.hpp"         // for ElementArena
+#include "ftxui/dom/node.hpp"                  // for LayoutStats
 #include "ftxui/dom/selection.hpp"             // for SelectionOption
 #include "ftxui/screen/screen.hpp"             // for Screen
 
@@ -76,6 +80,10 @@ class ScreenInteractive : public Screen {
   std::string GetSelection();
   void SelectionChange(std::function<void()> callback);
 
+  // Statistics.
+  std::uint64_t DroppedFrameCount() const;
+  LayoutStats LastLayoutStats() const;
+
  private:
   void ExitNow();
 
@@ -94,6 +102,7 @@ class ScreenInteractive : public Screen {
   void RefreshSelection();
   void Draw(Component component);
   void ResetCursorPosition();
+  bool FlushOutput(bool blocking);
 
   void Signal(int signal);
 
@@ -134,6 +143,31 @@ class ScreenInteractive : public Screen {
 
   bool frame_valid_ = false;
 
+  // The last frame printed on the terminal. Used to print only the difference.
+  Screen previous_frame_{0, 0};
+
+  // The output of the last frame. Reused to avoid allocations. Only the first
+  // |output_written_| bytes were accepted by the terminal so far.
+  std::string output_buffer_;
+  size_t output_written_ = 0;
+
+  // A non blocking file descriptor of the terminal, distinct from stdout, or
+  // -1.
+  int output_fd_ = -1;
+
+  // Whether a frame was skipped while the terminal was busy, and how many.
+  bool frame_dropped_ = false;
+  std::uint64_t dropped_frame_count_ = 0;
+
+  // How the layout of the last frame was computed.
+  LayoutStats layout_stats_;
+
+  // The memory of the elements rendered by the components.
+  ElementArena element_arena_;
+
+  // Whether the terminal supports the synchronized output mode (DEC 2026).
+  bool synchronized_output_ = false;
+
   bool force_handle_ctrl_c_ = true;
   bool force_handle_ctrl_z_ = true;
 
@@ -0,0 +1,166 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_DOM_DATA_TABLE_HPP
+#define FTXUI_DOM_DATA_TABLE_HPP
+
+#include <functional>  // for function
+#include <string>      // for string
+#include <vector>      // for vector
+
+#include "ftxui/dom/elements.hpp"  // for Element, BorderStyle, LIGHT
+#include "ftxui/screen/box.hpp"    // for Box
+#include "ftxui/screen/pixel.hpp"  // for PixelStyle
+
+namespace ftxui {
+
+class DataTableSelection;
+
+/// @brief DataTable draws a table of strings, without building an element per
+/// cell.
+///
+/// Its API follows `Table`. The cells are read from a vector of strings, or
+/// from a function returning the string of a cell. The borders and the
+/// separators are recorded per selection, and the styles are applied to the
+/// selected ranges when drawing.
+///
+/// Only the visible rows are drawn. However, the width of the columns is
+/// computed by reading every cell once per `Render()`. For a table of millions
+/// of cells, give the widths with `SetColumnWidth`: inside a `frame`, it then
+/// costs about the same as the few visible cells.
+///
+/// Unlike `Table`, the cells can't hold arbitrary elements, the styles are
+/// applied regardless of the order of the calls, and the text of the cells can
+/// be selected.
+///
+/// **example**
+/// ```cpp
+/// auto table = DataTable(100000, 3, [](int row, int column) {
+///   return std::to_string(row * column);
+/// });
+///
+/// table.SetColumnWidth(0, 10);
+/// table.SetColumnWidth(1, 10);
+/// table.SetColumnWidth(2, 10);
+/// table.SelectAll().Border(LIGHT);
+/// table.SelectAll().SeparatorVertical(LIGHT);
+///
+/// PixelStyle style;
+/// style.inverted = true;
+/// table.SelectRow(selected).DecorateCells(style);
+///
+/// // The row |selected| is drawn below the top border.
+/// Element document =
+///     table.Render() | focusPosition(0, selected + 1) | yframe;
+/// ```
+///
+/// @ingroup dom
+class DataTable {
+ public:
+  DataTable();
+  explicit DataTable(std::vector<std::vector<std::string>> cells);
+  DataTable(int rows,
+            int columns,
+            std::function<std::string(int row, int column)> cell);
+
+  void SetColumnWidth(int column, int width);
+
+  DataTableSelection SelectAll();
+  DataTableSelection SelectCell(int column, int row);
+  DataTableSelection SelectRow(int row_index);
+  DataTableSelection SelectRows(int row_min, int row_max);
+  DataTableSelection SelectColumn(int column_index);
+  DataTableSelection SelectColumns(int column_min, int column_max);
+  DataTableSelection SelectRectangle(int column_min,
+                                     int column_max,
+                                     int row_min,
+                                     int row_max);
+  Element Render();
+
+ private:
+  friend DataTableSelection;
+  class Grid;
+
+  // The positions of a selection an operation applies to. The grid holds the
+  // cells at odd positions, and the lines in between at even positions.
+  enum class Filter {
+    All,
+    VerticalLines,
+    HorizontalLines,
+    Lines,
+    Cells,
+    // The positions where |x / 2 % modulo == shift|, or |y / 2|.
+    AlternateColumn,
+    AlternateRow,
+    AlternateCellColumn,
+    AlternateCellRow,
+  };
+
+  // Draw a border character over the positions of |area|. When |glyph| is
+  // -1, the vertical or the horizontal character is used depending on the
+  // position.
+  struct LineOp {
+    Box area;
+    Filter filter;
+    BorderStyle border;
+    int glyph;
+  };
+
+  // Apply a style over the positions of |area|.
+  struct StyleOp {
+    Box area;
+    Filter filter;
+    int modulo;
+    int shift;
+    PixelStyle style;
+  };
+
+  int rows_ = 0;
+  int columns_ = 0;
+  std::function<std::string(int row, int column)> cell_;
+  std::vector<int> column_widths_;
+  std::vector<LineOp> lines_;
+  std::vector<StyleOp> styles_;
+};
+
+class DataTableSelection {
+ public:
+  void Decorate(const PixelStyle& style);
+  void DecorateAlternateRow(const PixelStyle& style,
+                            int modulo = 2,
+                            int shift = 0);
+  void DecorateAlternateColumn(const PixelStyle& style,
+                               int modulo = 2,
+                               int shift = 0);
+
+  void DecorateCells(const PixelStyle& style);
+  void DecorateCellsAlternateColumn(const PixelStyle& style,
+                                    int modulo = 2,
+                                    int shift = 0);
+  void DecorateCellsAlternateRow(const PixelStyle& style,
+                                 int modulo = 2,
+                                 int shift = 0);
+
+  void Border(BorderStyle border = LIGHT);
+  void BorderLeft(BorderStyle border = LIGHT);
+  void BorderRight(BorderStyle border = LIGHT);
+  void BorderTop(BorderStyle border = LIGHT);
+  void BorderBottom(BorderStyle border = LIGHT);
+
+  void Separator(BorderStyle border = LIGHT);
+  void SeparatorVertical(BorderStyle border = LIGHT);
+  void SeparatorHorizontal(BorderStyle border = LIGHT);
+
+ private:
+  friend DataTable;
+
+  DataTable* table_;
+  int x_min_;
+  int x_max_;
+  int y_min_;
+  int y_max_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_DATA_TABLE_HPP
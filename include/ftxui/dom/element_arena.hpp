@@ -0,0 +1,125 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_DOM_ELEMENT_ARENA_HPP
+#define FTXUI_DOM_ELEMENT_ARENA_HPP
+
+#include <cstddef>  // for size_t
+#include <memory>   // for shared_ptr, make_shared, allocate_shared
+#include <utility>  // for forward
+
+namespace ftxui {
+
+/// @brief ElementArena provides the memory of the elements built during a
+/// frame.
+///
+/// While an `ElementArena::Scope` is active on a thread, the elements built
+/// there (`text`, `hbox`, `border`, ...) are allocated from the arena, using a
+/// bump allocator. Destroying them costs nothing. Their memory is released in
+/// bulk, and reused by the next frame.
+///
+/// Elements may outlive the frame, or the arena itself. The memory is only
+/// released once every element allocated from it is destroyed.
+///
+/// ScreenInteractive uses an arena for the elements rendered by its
+/// components.
+///
+/// **example**
+/// ```cpp
+/// ElementArena arena;
+/// while (running) {
+///   arena.Reset();
+///   ElementArena::Scope scope(arena);
+///   Element document = Build();
+///   Render(screen, document);
+/// }
+/// ```
+///
+/// @ingroup dom
+class ElementArena {
+ public:
+  ElementArena();
+  ~ElementArena();
+  ElementArena(const ElementArena&) = delete;
+  ElementArena(ElementArena&&) = delete;
+  ElementArena& operator=(const ElementArena&) = delete;
+  ElementArena& operator=(ElementArena&&) = delete;
+
+  // Start a new frame. The memory of the previous one is reused when all its
+  // elements are destroyed.
+  void Reset();
+
+  // Allocate the elements built on this thread from |arena|, until the Scope
+  // is destroyed.
+  class Scope {
+   public:
+    explicit Scope(ElementArena& arena);
+    ~Scope();
+    Scope(const Scope&) = delete;
+    Scope(Scope&&) = delete;
+    Scope& operator=(const Scope&) = delete;
+    Scope& operator=(Scope&&) = delete;
+
+   private:
+    ElementArena* previous_;
+  };
+
+  // The memory of an arena. It is kept alive by the elements allocated from
+  // it.
+  class Pool;
+
+  // The pool used by the current thread, if any.
+  static Pool* Current();
+  static void* Allocate(Pool* pool, size_t size, size_t alignment);
+  static void Deallocate(Pool* pool) noexcept;
+
+  template <class T>
+  class Allocator {
+   public:
+    using value_type = T;
+
+    explicit Allocator(Pool* pool) : pool_(pool) {}
+    template <class U>
+    Allocator(const Allocator<U>& other)  // NOLINT
+        : pool_(other.pool()) {}
+
+    T* allocate(size_t n) {
+      return static_cast<T*>(Allocate(pool_, n * sizeof(T), alignof(T)));
+    }
+    void deallocate(T* /*p*/, size_t /*n*/) noexcept { Deallocate(pool_); }
+
+    Pool* pool() const { return pool_; }
+
+    template <class U>
+    bool operator==(const Allocator<U>& other) const {
+      return pool_ == other.pool();
+    }
+    template <class U>
+    bool operator!=(const Allocator<U>& other) const {
+      return pool_ != other.pool();
+    }
+
+   private:
+    Pool* pool_;
+  };
+
+ private:
+  Pool* pool_;
+};
+
+/// @brief Build an element, from the arena active on this thread if any.
+/// @see ElementArena
+/// @ingroup dom
+template <class T, class... Args>
+std::shared_ptr<T> MakeElement(Args&&... args) {
+  ElementArena::Pool* pool = ElementArena::Current();
+  if (!pool) {
+    return std::make_shared<T>(std::forward<Args>(args)...);
+  }
+  return std::allocate_shared<T>(ElementArena::Allocator<T>(pool),
+                                 std::forward<Args>(args)...);
+}
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_ELEMENT_ARENA_HPP
@@ -170,6 +170,11 @@ Element frame(Element);
 Element xframe(Element);
 Element yframe(Element);
 Element focus(Element);
+// A list of |count| rows, of |row_height| lines each. Only the rows visible
+// inside the frame are built, using |generator|.
+Element virtualList(int count,
+                    int row_height,
+                    std::function<Element(int)> generator);
 Element select(Element e);  // Deprecated - Alias for focus.
 
 // --- Cursor ---
@@ -0,0 +1,95 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_DOM_LAYOUT_CACHE_HPP
+#define FTXUI_DOM_LAYOUT_CACHE_HPP
+
+#include <cstddef>        // for size_t
+#include <cstdint>        // for uint32_t, uint64_t
+#include <string>         // for string
+#include <unordered_map>  // for unordered_map
+#include <vector>         // for vector
+
+#include "ftxui/dom/elements.hpp"     // for Element, Decorator
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/pixel.hpp"     // for Pixel
+
+namespace ftxui {
+
+class LayoutCacheNode;
+
+/// @brief LayoutCache keeps the layout and the drawing of elements from one
+/// frame to the next.
+///
+/// Elements are rebuilt every frame. The `cached` decorator identifies an
+/// element using a stable key, and a hash of its content. When both are
+/// unchanged, the requirement of the element is reused. When its box and the
+/// cells drawn below it are also unchanged, its cells are copied from the
+/// previous frame, without computing the layout of its children nor drawing
+/// them.
+///
+/// Elements containing the focus are never cached.
+///
+/// A frame is a call to `Render()` using the cache. The entries unused during
+/// `max_unused_frames` frames are removed when the next one starts.
+///
+/// **example**
+/// ```cpp
+/// LayoutCache cache;
+/// auto renderer = Renderer([&] {
+///   Elements elements;
+///   for (const Row& row : rows) {
+///     elements.push_back(RenderRow(row) | cached(cache, row.id, row.Hash()));
+///   }
+///   return vbox(std::move(elements));
+/// });
+/// ```
+///
+/// @ingroup dom
+class LayoutCache {
+ public:
+  explicit LayoutCache(int max_unused_frames = 30)
+      : max_unused_frames_(max_unused_frames) {}
+
+  // Remove every entry.
+  void Clear() { entries_.clear(); }
+  size_t size() const { return entries_.size(); }
+
+ private:
+  friend class LayoutCacheNode;
+
+  // Start a new frame when |render| differs from the previous one, removing
+  // the entries unused for too long.
+  void StartFrame(uint32_t render);
+
+  struct Entry {
+    size_t hash = 0;
+    // The last frame using this entry.
+    uint64_t frame = 0;
+    Requirement requirement;
+    Box box;
+
+    // The cells of |box|, before and after drawing the element, when it was
+    // fully visible. The hyperlinks of |cells| are indices into |links|, plus
+    // one. The cells are valid while the Glyph::InternedGeneration() is
+    // |generation|.
+    bool has_cells = false;
+    uint32_t generation = 0;
+    std::vector<Pixel> below;
+    std::vector<Pixel> cells;
+    std::vector<std::string> links;
+  };
+  std::unordered_map<std::string, Entry> entries_;
+
+  const int max_unused_frames_;
+  uint32_t render_ = 0;
+  uint64_t frame_ = 0;
+};
+
+Decorator cached(LayoutCache& cache, std::string key, size_t hash);
+Element cached(Element child, LayoutCache& cache, std::string key, size_t hash);
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_LAYOUT_CACHE_HPP
@@ -16,6 +16,7 @@ namespace ftxui {
 
 class Node;
 class Screen;
+struct LayoutStats;
 
 using Element = std::shared_ptr<Node>;
 using Elements = std::vector<Element>;
@@ -61,6 +62,9 @@ class Node {
 
   // Step 4: Draw this element.
   virtual void Render(Screen& screen);
+  // Draw this element, unless it is entirely outside of the stencil.
+  // Containers call it on their children, instead of Render().
+  void RenderIfVisible(Screen& screen);
 
   virtual std::string GetSelectedContent(Selection& selection);
 
@@ -70,20 +74,56 @@ class Node {
   struct Status {
     int iteration = 0;
     bool need_iteration = false;
+    // The number of nodes to lay out again in the next iteration.
+    int invalid_nodes = 0;
   };
   virtual void Check(Status* status);
 
-  friend void Render(Screen& screen, Node* node, Selection& selection);
+  // Incremental layout. After the first iteration, only the subtrees where a
+  // node requested another one are laid out again. Containers call these on
+  // their children, instead of Check(), ComputeRequirement() and SetBox().
+  void CheckLayout(Status* status);
+  void UpdateRequirement();
+  void UpdateBox(Box box);
+
+  friend void Render(Screen& screen,
+                     Node* node,
+                     Selection& selection,
+                     LayoutStats& stats);
 
  protected:
   Elements children_;
   Requirement requirement_;
   Box box_;
+
+ private:
+  // Whether the requirement and the box from the previous iteration are still
+  // valid. Set by CheckLayout(), used once.
+  bool requirement_valid_ = false;
+  bool box_valid_ = false;
+  Box layout_box_;
+};
+
+/// @brief Statistics about the layout and the drawing of an element.
+/// @ingroup dom
+struct LayoutStats {
+  // The number of layout iterations.
+  int passes = 0;
+  // The number of nodes whose requirement was computed, summed over the
+  // iterations.
+  int recomputed_nodes = 0;
+  // The number of nodes not drawn, because they were outside of the stencil.
+  // Their children aren't counted.
+  int culled_nodes = 0;
 };
 
 void Render(Screen& screen, const Element& element);
 void Render(Screen& screen, Node* node);
 void Render(Screen& screen, Node* node, Selection& selection);
+void Render(Screen& screen,
+            Node* node,
+            Selection& selection,
+            LayoutStats& stats);
 std::string GetNodeSelectedContent(Screen& screen,
                                    Node* node,
                                    Selection& selection);
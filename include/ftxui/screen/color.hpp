@@ -318,9 +318,13 @@ class Color {
   bool operator!=(const Color& rhs) const;
 
   std::string Print(bool is_background_color) const;
+  void Print(bool is_background_color, std::string& output) const;
   bool IsOpaque() const { return alpha_ == 255; }
 
  private:
+  // The closest color supported by the terminal.
+  Color Quantize() const;
+
   enum class ColorType : uint8_t {
     Palette1,
     Palette16,
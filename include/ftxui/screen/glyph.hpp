@@ -0,0 +1,69 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_SCREEN_GLYPH_HPP
+#define FTXUI_SCREEN_GLYPH_HPP
+
+#include <array>        // for array
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint8_t, uint32_t
+#include <iosfwd>       // for ostream
+#include <string>       // for string
+#include <string_view>  // for string_view
+
+namespace ftxui {
+
+/// @brief The grapheme displayed by a Pixel, stored in 8 bytes.
+///
+/// Graphemes up to 8 bytes are stored inline. This covers ASCII, box drawing,
+/// CJK characters and most emojis. Longer ones are interned into a process
+/// wide table, and referenced by their id. See `ReleaseInterned()`.
+///
+/// The number of terminal cells the grapheme occupies is computed once, when
+/// the Glyph is built.
+///
+/// A Glyph behaves mostly like the std::string it replaces: it can be assigned
+/// from a string, compared with a string, and converted into a string.
+///
+/// @ingroup screen
+class Glyph {
+ public:
+  Glyph() = default;
+  Glyph(const char* str);         // NOLINT
+  Glyph(const std::string& str);  // NOLINT
+  Glyph(std::string_view str);    // NOLINT
+  Glyph(std::string_view str, int width);
+
+  bool empty() const { return bytes_[0] == '\0'; }
+  int width() const { return width_; }
+  size_t size() const { return view().size(); }
+  std::string_view view() const;
+  std::string str() const { return std::string(view()); }
+  operator std::string() const { return str(); }  // NOLINT
+
+  // Bound the size of the table of the interned graphemes.
+  static void ReleaseInterned();
+  static size_t InternedCount();
+  static uint32_t InternedGeneration();
+
+  friend bool operator==(const Glyph& a, const Glyph& b) {
+    return a.bytes_ == b.bytes_ && a.width_ == b.width_;
+  }
+  friend bool operator!=(const Glyph& a, const Glyph& b) {
+    return !(a == b);
+  }
+
+ private:
+  // UTF-8 never uses the byte 0xFF. It marks an interned grapheme, whose id
+  // is stored in the last 4 bytes.
+  static constexpr char kInterned = char(0xFF);
+
+  std::array<char, 8> bytes_ = {};
+  uint8_t width_ = 0;
+};
+
+std::ostream& operator<<(std::ostream& out, const Glyph& glyph);
+
+}  // namespace ftxui
+
+#endif  // FTXUI_SCREEN_GLYPH_HPP
@@ -4,14 +4,41 @@
 #ifndef FTXUI_SCREEN_IMAGE_HPP
 #define FTXUI_SCREEN_IMAGE_HPP
 
-#include <string>  // for string, basic_string, allocator
-#include <vector>  // for vector
+#include <cstddef>        // for size_t
+#include <cstdint>        // for uint8_t
+#include <string>         // for string
+#include <unordered_map>  // for unordered_map
+#include <vector>         // for vector
 
 #include "ftxui/screen/box.hpp"    // for Box
-#include "ftxui/screen/pixel.hpp"  // for Pixel
+#include "ftxui/screen/glyph.hpp"  // for Glyph
+#include "ftxui/screen/pixel.hpp"  // for Pixel, PixelStyle
 
 namespace ftxui {
 
+/// @brief A contiguous range of pixels, part of a row of an Image.
+/// @ingroup screen
+template <typename T>
+class BasicPixelSpan {
+ public:
+  BasicPixelSpan() = default;
+  BasicPixelSpan(T* data, size_t size) : data_(data), size_(size) {}
+
+  T* begin() const { return data_; }
+  T* end() const { return data_ + size_; }
+  T* data() const { return data_; }
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  T& operator[](size_t i) const { return data_[i]; }
+
+ private:
+  T* data_ = nullptr;
+  size_t size_ = 0;
+};
+
+using PixelSpan = BasicPixelSpan<Pixel>;
+using ConstPixelSpan = BasicPixelSpan<const Pixel>;
+
 /// @brief A rectangular grid of Pixel.
 /// @ingroup screen
 class Image {
@@ -21,6 +48,9 @@ class Image {
   Image(int dimx, int dimy);
 
   // Access a character in the grid at a given position.
+  // Deprecated: the pixels hold a Glyph, use `PixelAt(x, y).character`. The
+  // string is a copy, written back into the pixel by the next access to the
+  // image. This also invalidates the reference.
   std::string& at(int x, int y);
   const std::string& at(int x, int y) const;
 
@@ -28,6 +58,14 @@ class Image {
   Pixel& PixelAt(int x, int y);
   const Pixel& PixelAt(int x, int y) const;
 
+  // Access the pixels of the row |y| in between |x_min| and |x_max|
+  // (inclusive), clipped by the stencil.
+  PixelSpan RowAt(int y, int x_min, int x_max);
+  ConstPixelSpan RowAt(int y, int x_min, int x_max) const;
+
+  // Apply a style to every pixel of |box|, clipped by the stencil.
+  void ApplyStyle(const Box& box, const PixelStyle& style);
+
   // Get screen dimensions.
   int dimx() const { return dimx_; }
   int dimy() const { return dimy_; }
@@ -40,7 +78,18 @@ class Image {
  protected:
   int dimx_;
   int dimy_;
-  std::vector<std::vector<Pixel>> pixels_;
+  // The pixels, stored contiguously row after row.
+  std::vector<Pixel> pixels_;
+  // Whether each row was accessed through PixelAt() or RowAt() since the last
+  // Clear(). The other rows are still cleared, Screen::ApplyShader skips them.
+  std::vector<uint8_t> modified_rows_;
+
+  // The strings returned by at(), indexed like |pixels_|. Those returned by
+  // the non const at() are written back into the pixels by
+  // CommitCharacters(), before any other access.
+  mutable std::unordered_map<size_t, std::string> characters_;
+  mutable std::unordered_map<size_t, std::string> read_characters_;
+  void CommitCharacters() const;
 };
 
 }  // namespace ftxui
@@ -4,9 +4,10 @@
 #ifndef FTXUI_SCREEN_PIXEL_HPP
 #define FTXUI_SCREEN_PIXEL_HPP
 
-#include <cstdint>                 // for uint8_t
-#include <string>                  // for string, basic_string, allocator
+#include <cstdint>                 // for uint16_t
+#include <optional>                // for optional
 #include "ftxui/screen/color.hpp"  // for Color, Color::Default
+#include "ftxui/screen/glyph.hpp"  // for Glyph
 
 namespace ftxui {
 
@@ -38,17 +39,39 @@ struct Pixel {
   // The hyperlink associated with the pixel.
   // 0 is the default value, meaning no hyperlink.
   // It's an index for accessing Screen meta data
-  uint8_t hyperlink = 0;
+  uint16_t hyperlink = 0;
 
   // The graphemes stored into the pixel. To support combining characters,
   // like: a?, this can potentially contain multiple codepoints.
-  std::string character = "";
+  Glyph character;
 
   // Colors:
   Color background_color = Color::Default;
   Color foreground_color = Color::Default;
 };
 
+/// @brief A style applied at once to a rectangle of Pixel.
+/// @see Image::ApplyStyle
+/// @ingroup screen
+struct PixelStyle {
+  // The attributes to enable:
+  bool blink = false;
+  bool bold = false;
+  bool dim = false;
+  bool italic = false;
+  bool underlined = false;
+  bool underlined_double = false;
+  bool strikethrough = false;
+  bool automerge = false;
+
+  // Toggle the inversion of the foreground and background colors:
+  bool inverted = false;
+
+  // The colors to apply. Non opaque colors are blended with the current ones.
+  std::optional<Color> background_color;
+  std::optional<Color> foreground_color;
+};
+
 }  // namespace ftxui
 
 #endif  // FTXUI_SCREEN_PIXEL_HPP
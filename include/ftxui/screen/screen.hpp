@@ -4,9 +4,12 @@
 #ifndef FTXUI_SCREEN_SCREEN_HPP
 #define FTXUI_SCREEN_SCREEN_HPP
 
-#include <cstdint>     // for uint8_t
-#include <functional>  // for function
-#include <string>      // for string, basic_string, allocator
+#include <cstdint>      // for uint16_t
+#include <cstdio>       // for FILE
+#include <functional>   // for function
+#include <memory>       // for shared_ptr
+#include <string>       // for string, basic_string, allocator
+#include <string_view>  // for string_view
 #include <vector>      // for vector
 
 #include "ftxui/screen/image.hpp"     // for Pixel, Image
@@ -32,12 +35,35 @@ class Screen : public Image {
   static Screen Create(Dimensions width, Dimensions height);
 
   std::string ToString() const;
+  void ToString(std::string& output) const;
+
+  // Same as ToString(output), but the rows are encoded by up to |thread_count|
+  // threads. The output is identical. 0 uses one thread per hardware core.
+  void ToStringParallel(std::string& output, int thread_count = 0) const;
+
+  // Produce the output updating the terminal from |previous| to this screen.
+  // When |scroll| is set, rows shifted vertically are moved using a scroll
+  // region instead of being printed again. This requires the screen to be
+  // displayed from the first row of the terminal.
+  std::string ToStringDiff(const Screen& previous) const;
+  void ToStringDiff(const Screen& previous,
+                    std::string& output,
+                    bool scroll = false) const;
+
+  // A destination receiving the output of the Screen, chunk by chunk.
+  using Sink = std::function<void(std::string_view)>;
+  static Sink FileSink(std::FILE* file);
+  static Sink FileDescriptorSink(int fd);
+
+  // Stream the output of the Screen, or of a |box| of it, into |sink|. A
+  // single row is held in memory at a time.
+  void ToSink(const Sink& sink) const;
+  void ToSink(const Box& box, const Sink& sink) const;
 
   // Print the Screen on to the terminal.
   void Print() const;
 
-  // Fill the screen with space and reset any screen state, like hyperlinks, and
-  // cursor
+  // Fill the screen with space and reset any screen state, like the cursor.
   void Clear();
 
   // Move the terminal cursor n-lines up with n = dimy().
@@ -65,9 +91,10 @@ class Screen : public Image {
   void SetCursor(Cursor cursor) { cursor_ = cursor; }
 
   // Store an hyperlink in the screen. Return the id of the hyperlink. The id is
-  // used to identify the hyperlink when the user click on it.
-  uint8_t RegisterHyperlink(const std::string& link);
-  const std::string& Hyperlink(uint8_t id) const;
+  // used to identify the hyperlink when the user click on it. The ids are kept
+  // across frames.
+  uint16_t RegisterHyperlink(const std::string& link);
+  const std::string& Hyperlink(uint16_t id) const;
 
   using SelectionStyle = std::function<void(Pixel&)>;
   const SelectionStyle& GetSelectionStyle() const;
@@ -75,7 +102,11 @@ class Screen : public Image {
 
  protected:
   Cursor cursor_;
-  std::vector<std::string> hyperlinks_ = {""};
+
+  // The registered hyperlinks. It is shared with the copies of the screen. It
+  // is only appended to, so the ids stay valid for all of them.
+  class HyperlinkRegistry;
+  std::shared_ptr<HyperlinkRegistry> hyperlinks_;
 
   // The current selection style. This is overridden by various dom elements.
   SelectionStyle selection_style_ = [](Pixel& pixel) {
@@ -14,6 +14,7 @@
 #include "ftxui/component/component_base.hpp"  // for ComponentBase, Components
 #include "ftxui/component/event.hpp"           // for Event
 #include "ftxui/component/screen_interactive.hpp"  // for Component, ScreenInteractive
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
 #include "ftxui/dom/elements.hpp"                  // for text, Element
 #include "ftxui/dom/node.hpp"                      // for Node, Elements
 #include "ftxui/screen/box.hpp"                    // for Box
@@ -120,7 +121,7 @@ Element ComponentBase::Render() {
 
     void SetBox(Box box) override {
       Node::SetBox(box);
-      children_[0]->SetBox(box);
+      children_[0]->UpdateBox(box);
     }
 
     void ComputeRequirement() override {
@@ -129,7 +130,7 @@ Element ComponentBase::Render() {
     }
   };
 
-  return std::make_shared<Wrapper>(std::move(element), Active());
+  return MakeElement<Wrapper>(std::move(element), Active());
 }
 
 /// @brief Draw the component.
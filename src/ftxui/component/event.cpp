@@ -68,6 +68,22 @@ Event Event::CursorShape(std::string input, int shape) {
   return event;
 }
 
+/// @brief An event corresponding to a terminal DECRPM (Report Mode), answering
+/// a DECRQM (Request Mode).
+/// @param input The sequence of character send by the terminal.
+/// @param mode The DEC private mode reported.
+/// @param status 0: unknown, 1: set, 2: reset, 3: permanently set, 4:
+///               permanently reset.
+// static
+Event Event::ModeReport(std::string input, int mode, int status) {
+  Event event;
+  event.input_ = std::move(input);
+  event.type_ = Type::ModeReport;
+  event.data_.mode_report.mode = mode;      // NOLINT
+  event.data_.mode_report.status = status;  // NOLINT
+  return event;
+}
+
 /// @brief An custom event whose meaning is defined by the user of the library.
 /// @param input An arbitrary sequence of character defined by the developer.
 // static
@@ -264,6 +280,10 @@ std::string Event::DebugString() const {
     case Type::CursorShape:
       return "Event::CursorShape(" + input_ + ", " +
              std::to_string(data_.cursor_shape) + ")";
+    case Type::ModeReport:
+      return "Event::ModeReport(" + input_ + ", " +
+             std::to_string(data_.mode_report.mode) + ", " +
+             std::to_string(data_.mode_report.status) + ")";
     case Type::CursorPosition:
       return "Event::CursorPosition(" + input_ + ", " +
              std::to_string(data_.cursor.x) + ", " +
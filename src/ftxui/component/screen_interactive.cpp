@@ -6,6 +6,7 @@
 #include <array>      // for array
 #include <atomic>
 #include <chrono>  // for operator-, milliseconds, operator>=, duration, common_type<>::type, time_point
+#include <cerrno>  // for errno, EINTR
 #include <csignal>  // for signal, SIGTSTP, SIGABRT, SIGWINCH, raise, SIGFPE, SIGILL, SIGINT, SIGSEGV, SIGTERM, __sighandler_t, size_t
 #include <cstdint>
 #include <cstdio>                    // for fileno, stdin
@@ -30,8 +31,10 @@
 #include "ftxui/component/loop.hpp"            // for Loop
 #include "ftxui/component/receiver.hpp"  // for ReceiverImpl, Sender, MakeReceiver, SenderImpl, Receiver
 #include "ftxui/component/terminal_input_parser.hpp"  // for TerminalInputParser
+#include "ftxui/dom/element_arena.hpp"  // for ElementArena
 #include "ftxui/dom/node.hpp"                         // for Node, Render
 #include "ftxui/dom/requirement.hpp"                  // for Requirement
+#include "ftxui/screen/glyph.hpp"                     // for Glyph
 #include "ftxui/screen/pixel.hpp"                     // for Pixel
 #include "ftxui/screen/terminal.hpp"                  // for Dimensions, Size
 #include "ftxui/screen/util.hpp"                      // for util::clamp
@@ -47,9 +50,11 @@
 #error Must be compiled in UNICODE mode
 #endif
 #else
+#include <fcntl.h>       // for open, O_WRONLY, O_NONBLOCK, O_NOCTTY, O_CLOEXEC
+#include <poll.h>        // for poll, pollfd, POLLOUT
 #include <sys/select.h>  // for select, FD_ISSET, FD_SET, FD_ZERO, fd_set, timeval
 #include <termios.h>  // for tcsetattr, termios, tcgetattr, TCSANOW, cc_t, ECHO, ICANON, VMIN, VTIME
-#include <unistd.h>  // for STDIN_FILENO, read
+#include <unistd.h>  // for STDIN_FILENO, read, write, close, isatty, ttyname
 #endif
 
 // Quick exit is missing in standard CLang headers
@@ -73,8 +78,59 @@ namespace {
 ScreenInteractive* g_active_screen = nullptr;  // NOLINT
 
 void Flush() {
+#if defined(__EMSCRIPTEN__)
   // Emscripten doesn't implement flush. We interpret zero as flush.
-  std::cout << '\0' << std::flush;
+  std::cout << '\0';
+#endif
+  std::cout << std::flush;
+}
+
+// Write |size| bytes from |data| to the terminal, using a single system call
+// when possible. |fd| is a non blocking description of the terminal: give up
+// instead of waiting for the terminal to consume its input. When |fd| is -1,
+// write to stdout and wait. Returns the number of bytes written.
+size_t Write(const char* data, size_t size, int fd) {
+#if defined(_WIN32) || defined(__EMSCRIPTEN__)
+  (void)fd;
+  std::cout.write(data, static_cast<std::streamsize>(size));
+  Flush();
+  return size;
+#else
+  // What was previously written using std::cout must be printed first.
+  std::cout << std::flush;
+
+  const bool blocking = fd < 0;
+  if (blocking) {
+    fd = STDOUT_FILENO;
+  }
+
+  size_t written = 0;
+  while (written < size) {
+    const ssize_t n = write(fd, data + written, size - written);
+    if (n >= 0) {
+      written += static_cast<size_t>(n);
+      continue;
+    }
+
+    if (errno == EINTR) {
+      continue;
+    }
+
+    if (errno != EAGAIN && errno != EWOULDBLOCK) {
+      written = size;  // Unrecoverable. Drop the output.
+      break;
+    }
+
+    if (!blocking) {
+      break;
+    }
+
+    // stdout was made non blocking by someone else. Wait for it.
+    struct pollfd pending = {fd, POLLOUT, 0};
+    poll(&pending, 1, -1);
+  }
+  return written;
+#endif
 }
 
 constexpr int timeout_milliseconds = 20;
@@ -186,8 +242,9 @@ void EventListener(std::atomic<bool>* quit, Sender<Task> out) {
 
     const size_t buffer_size = 100;
     std::array<char, buffer_size> buffer;                        // NOLINT;
-    size_t l = read(fileno(stdin), buffer.data(), buffer_size);  // NOLINT
-    for (size_t i = 0; i < l; ++i) {
+    const ssize_t l = read(fileno(stdin), buffer.data(), buffer_size);
+    // Nothing to read, when stdin was made non blocking by someone else.
+    for (ssize_t i = 0; i < l; ++i) {
       parser.Add(buffer[i]);  // NOLINT
     }
   }
@@ -272,6 +329,10 @@ const std::string ST = "\x1b\\";  // NOLINT
 // DECSCUSR: Set Cursor Style
 const std::string DECRQSS_DECSCUSR = DCS + "$q q" + ST;  // NOLINT
 
+// DECRQM: Request Mode
+// 2026: Synchronized Output
+const std::string DECRQM_SYNCHRONIZED_OUTPUT = CSI + "?2026$p";  // NOLINT
+
 // DEC: Digital Equipment Corporation
 enum class DECMode : std::uint16_t {
   kLineWrap = 7,
@@ -289,6 +350,7 @@ enum class DECMode : std::uint16_t {
   kMouseUrxvtMode = 1015,
   kMouseSgrPixelsMode = 1016,
   kAlternateScreen = 1049,
+  kSynchronizedOutput = 2026,
 };
 
 // Device Status Report (DSR) {
@@ -601,6 +663,10 @@ ScreenInteractive* ScreenInteractive::Active() {
 void ScreenInteractive::Install() {
   frame_valid_ = false;
 
+  // The terminal content might have been modified while uninstalled. Force
+  // the next frame to be fully printed.
+  previous_frame_ = Screen(0, 0);
+
   // Flush the buffer for stdout to ensure whatever the user has printed before
   // is fully applied before we start modifying the terminal configuration. This
   // is important, because we are using two different channels (stdout vs
@@ -617,6 +683,10 @@ void ScreenInteractive::Install() {
   // Request the terminal to report the current cursor shape. We will restore it
   // on exit.
   std::cout << DECRQSS_DECSCUSR;
+
+  // Request the terminal to report whether it supports synchronized output.
+  // Frames are then displayed atomically, without tearing.
+  std::cout << DECRQM_SYNCHRONIZED_OUTPUT;
   on_exit_functions.emplace([this] {
     std::cout << "\033[?25h";  // Enable cursor.
     std::cout << "\033[" + std::to_string(cursor_reset_shape_) + " q";
@@ -697,6 +767,20 @@ void ScreenInteractive::Install() {
 
   tcsetattr(STDIN_FILENO, TCSANOW, &terminal);
 
+  // The frames are written to a separate, non blocking, description of the
+  // terminal. Setting O_NONBLOCK on stdout would also affect stdin and the
+  // other processes sharing it.
+  const char* tty = isatty(STDOUT_FILENO) ? ttyname(STDOUT_FILENO) : nullptr;
+  if (tty) {
+    output_fd_ = open(tty, O_WRONLY | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+    on_exit_functions.emplace([this] {
+      if (output_fd_ >= 0) {
+        close(output_fd_);
+        output_fd_ = -1;
+      }
+    });
+  }
+
 #endif
 
   auto enable = [&](const std::vector<DECMode>& parameters) {
@@ -744,6 +828,7 @@ void ScreenInteractive::Uninstall() {
   ExitNow();
   event_listener_.join();
   animation_listener_.join();
+  FlushOutput(/*blocking=*/true);
   OnExit();
 }
 
@@ -797,6 +882,15 @@ void ScreenInteractive::HandleTask(Component component, Task& task) {
         return;
       }
 
+      if (arg.is_mode_report()) {
+        if (arg.mode() == int(DECMode::kSynchronizedOutput)) {
+          // 1: set, 2: reset, 3: permanently set.
+          synchronized_output_ = arg.mode_status() >= 1 &&
+                                 arg.mode_status() <= 3;
+        }
+        return;
+      }
+
       if (arg.is_mouse()) {
         arg.mouse().x -= cursor_x_;
         arg.mouse().y -= cursor_y_;
@@ -905,9 +999,27 @@ bool ScreenInteractive::HandleSelection(bool handled, Event event) {
 // private
 // NOLINTNEXTLINE
 void ScreenInteractive::Draw(Component component) {
+  // The terminal is still consuming the previous frame. Rather than blocking,
+  // skip this one. Only the latest state is drawn once the terminal catches up.
+  if (!FlushOutput(/*blocking=*/false)) {
+    if (!frame_valid_) {
+      frame_valid_ = true;
+      frame_dropped_ = true;
+      dropped_frame_count_++;
+    }
+    return;
+  }
+  if (frame_dropped_) {
+    frame_dropped_ = false;
+    frame_valid_ = false;
+  }
+
   if (frame_valid_) {
     return;
   }
+  // The elements of the previous frame are destroyed. Reuse their memory.
+  element_arena_.Reset();
+  const ElementArena::Scope arena_scope(element_arena_);
   auto document = component->Render();
   int dimx = 0;
   int dimy = 0;
@@ -933,21 +1045,31 @@ void ScreenInteractive::Draw(Component component) {
   }
 
   const bool resized = frame_count_ == 0 || (dimx != dimx_) || (dimy != dimy_);
-  ResetCursorPosition();
-  std::cout << ResetPosition(/*clear=*/resized);
+
+  // The whole frame is assembled into a single buffer, written at once.
+  output_buffer_.clear();
+  if (synchronized_output_) {
+    output_buffer_ += "\x1B[?2026h";  // Begin synchronized update.
+  }
+  output_buffer_ += reset_cursor_position;
+  reset_cursor_position.clear();
+  output_buffer_ += ResetPosition(/*clear=*/resized);
 
   // If the terminal width decrease, the terminal emulator will start wrapping
   // lines and make the display dirty. We should clear it completely.
   if ((dimx < dimx_) && !use_alternative_screen_) {
-    std::cout << "\033[J";  // clear terminal output
-    std::cout << "\033[H";  // move cursor to home position
+    output_buffer_ += "\033[J";  // clear terminal output
+    output_buffer_ += "\033[H";  // move cursor to home position
   }
 
   // Resize the screen if needed.
   if (resized) {
     dimx_ = dimx;
     dimy_ = dimy;
-    pixels_ = std::vector<std::vector<Pixel>>(dimy, std::vector<Pixel>(dimx));
+    pixels_.assign(size_t(dimx) * size_t(dimy), Pixel());
+    modified_rows_.assign(size_t(dimy), 0);
+    characters_.clear();
+    read_characters_.clear();
     cursor_.x = dimx_ - 1;
     cursor_.y = dimy_ - 1;
   }
@@ -965,14 +1087,14 @@ void ScreenInteractive::Draw(Component component) {
   static int i = -3;
   ++i;
   if (!use_alternative_screen_ && (i % 150 == 0)) {  // NOLINT
-    std::cout << DeviceStatusReport(DSRMode::kCursor);
+    output_buffer_ += DeviceStatusReport(DSRMode::kCursor);
   }
 #else
   static int i = -3;
   ++i;
   if (!use_alternative_screen_ &&
       (previous_frame_resized_ || i % 40 == 0)) {  // NOLINT
-    std::cout << DeviceStatusReport(DSRMode::kCursor);
+    output_buffer_ += DeviceStatusReport(DSRMode::kCursor);
   }
 #endif
   previous_frame_resized_ = resized;
@@ -982,7 +1104,7 @@ void ScreenInteractive::Draw(Component component) {
                    : std::make_unique<Selection>(
                          selection_data_.start_x, selection_data_.start_y,  //
                          selection_data_.end_x, selection_data_.end_y);
-  Render(*this, document.get(), *selection_);
+  Render(*this, document.get(), *selection_, layout_stats_);
 
   // Set cursor position for user using tools to insert CJK characters.
   {
@@ -1011,19 +1133,77 @@ void ScreenInteractive::Draw(Component component) {
     }
   }
 
-  std::cout << ToString() << set_cursor_position;
-  Flush();
+  // Only print the cells modified since the previous frame, unless the
+  // terminal content can't be trusted anymore.
+  const bool full_repaint = resized || previous_frame_.dimx() != dimx_ ||
+                            previous_frame_.dimy() != dimy_;
+  if (full_repaint) {
+    ToString(output_buffer_);
+  } else {
+    // A fullscreen frame starts at the first row of the terminal, so rows
+    // shifted since the previous frame can be moved using a scroll region.
+    ToStringDiff(previous_frame_, output_buffer_,
+                 /*scroll=*/dimension_ == Dimension::Fullscreen);
+
+    // Move the cursor where printing the whole frame would have left it.
+    const int end_x = dimx_ - 1 + int(dimx_ != terminal.dimx);
+    if (end_x > 0) {
+      output_buffer_ += "\x1B[" + std::to_string(end_x + 1) + "G";
+    }
+  }
+  output_buffer_ += set_cursor_position;
+  if (synchronized_output_) {
+    output_buffer_ += "\x1B[?2026l";  // End synchronized update.
+  }
+  output_written_ = 0;
+  FlushOutput(/*blocking=*/false);
+  previous_frame_ = *this;
   Clear();
   frame_valid_ = true;
   frame_count_++;
+
+  // Bound the table of the long graphemes. Those of this frame, kept by
+  // |previous_frame_|, remain valid until the next release.
+  const size_t max_interned_glyphs = 4096;
+  if (Glyph::InternedCount() > max_interned_glyphs) {
+    Glyph::ReleaseInterned();
+  }
 }
 
 // private
 void ScreenInteractive::ResetCursorPosition() {
+  FlushOutput(/*blocking=*/true);
   std::cout << reset_cursor_position;
   reset_cursor_position = "";
 }
 
+// private
+// Write what remains of the last frame. Return whether everything was written.
+bool ScreenInteractive::FlushOutput(bool blocking) {
+  if (output_written_ == output_buffer_.size()) {
+    return true;
+  }
+  // Without a non blocking description of the terminal, stdout is used and
+  // the frames are never dropped.
+  output_written_ += Write(output_buffer_.data() + output_written_,
+                           output_buffer_.size() - output_written_,
+                           blocking ? -1 : output_fd_);
+  return output_written_ == output_buffer_.size();
+}
+
+/// @brief Return the number of frames skipped, because the terminal was still
+/// busy consuming the previous one. This happens with slow terminals, or slow
+/// connections.
+std::uint64_t ScreenInteractive::DroppedFrameCount() const {
+  return dropped_frame_count_;
+}
+
+/// @brief Return how the layout of the last frame was computed: the number of
+/// layout iterations, and the number of nodes laid out.
+LayoutStats ScreenInteractive::LastLayoutStats() const {
+  return layout_stats_;
+}
+
 /// @brief Return a function to exit the main loop.
 Closure ScreenInteractive::ExitLoopClosure() {
   return [this] { Exit(); };
@@ -15,6 +15,7 @@
 #include <unistd.h>
 #include <array>
 #include <cstdio>
+#include <cstdlib>
 #include <ftxui/component/loop.hpp>
 #include <string>
 #endif
@@ -197,15 +198,14 @@ TEST(ScreenInteractive, FixedSizeInitialFrame) {
 
   auto expected =
       // Install the ScreenInteractive.
-      "\0"           // Flush stdout.
-      "\x1BP$q q"    // Set cursor shape to 1 (block).
-      "\x1B\\"       // Reset cursor position.
+      "\x1BP$q q"    // Request the cursor shape.
+      "\x1B\\"       //
+      "\x1B[?2026$p" // Request the synchronized output support.
       "\x1B[?7l"     // Disable line wrapping.
       "\x1B[?1000h"  // Enable mouse tracking.
       "\x1B[?1003h"  // Enable mouse motion tracking.
       "\x1B[?1015h"  // Enable mouse wheel tracking.
       "\x1B[?1006h"  // Enable SGR mouse tracking.
-      "\0"           // Flush stdout.
 
       // Reset the screen.
       "\r"       // Reset cursor position.
@@ -221,9 +221,6 @@ TEST(ScreenInteractive, FixedSizeInitialFrame) {
       "\x1B[1D"    // Move cursor left one character.
       "\x1B[?25l"  // Hide cursor.
 
-      // Flush
-      "\0"  // Flush stdout.
-
       // Uninstall the ScreenInteractive.
       "\x1B[1C"      // Move cursor right one character.
       "\x1B[?1006l"  // Disable SGR mouse tracking.
@@ -233,7 +230,6 @@ TEST(ScreenInteractive, FixedSizeInitialFrame) {
       "\x1B[?7h"     // Enable line wrapping.
       "\x1B[?25h"    // Show cursor.
       "\x1B[1 q"     // Set cursor shape to 1 (block).
-      "\0"           // Flush stdout.
 
       // Skip one line to avoid the prompt to be printed over the last drawing.
       "\r\n"sv;
@@ -241,4 +237,151 @@ TEST(ScreenInteractive, FixedSizeInitialFrame) {
 #endif
 }
 
+TEST(ScreenInteractive, PrintOnlyModifiedCells) {
+#if defined(__unix__)
+  std::string output;
+  {
+    auto capture = StdCapture(&output);
+
+    auto screen = ScreenInteractive::FixedSize(4, 2);
+    std::string content = "ABCD";
+    auto component = Renderer([&] { return text(content); });
+
+    Loop loop(&screen, component);
+    loop.RunOnce();
+
+    content = "ABXD";
+    screen.PostEvent(Event::Custom);
+    loop.RunOnce();
+  }
+  using namespace std::string_view_literals;
+
+  auto expected =
+      // Reset the cursor position, without clearing the screen.
+      "\x1B[1C"  // Move cursor right one character.
+      "\r"       // Reset cursor position.
+      "\x1B[1A"  // Move cursor up one line.
+      "\x1B[6n"  // Request cursor position.
+
+      // Print the modified cell only.
+      "\x1B[3G"    // Move cursor to the third column.
+      "X"          // Print "X".
+      "\x1B[1B"    // Move cursor down one line.
+      "\r"         // Move cursor to the beginning of the line.
+      "\x1B[5G"    // Move cursor after the end of the line.
+
+      // Set cursor position.
+      "\x1B[1D"    // Move cursor left one character.
+      "\x1B[?25l"sv;  // Hide cursor.
+  ASSERT_NE(output.find(expected), std::string::npos);
+#endif
+}
+
+TEST(ScreenInteractive, SynchronizedOutput) {
+#if defined(__unix__)
+  std::string output;
+  {
+    auto capture = StdCapture(&output);
+
+    auto screen = ScreenInteractive::FixedSize(2, 1);
+    auto component = Renderer([&] { return text("AB"); });
+
+    Loop loop(&screen, component);
+    loop.RunOnce();
+
+    // The terminal reports supporting the synchronized output mode.
+    screen.PostEvent(Event::ModeReport("\x1B[?2026;2$y", 2026, 2));
+    screen.PostEvent(Event::Custom);
+    loop.RunOnce();
+  }
+  using namespace std::string_view_literals;
+
+  // The first frame isn't synchronized. The second one is.
+  EXPECT_EQ(output.find("\x1B[?2026h"), output.rfind("\x1B[?2026h"));
+  const size_t begin = output.find("\x1B[?2026h");
+  const size_t end = output.find("\x1B[?2026l");
+  ASSERT_NE(begin, std::string::npos);
+  ASSERT_NE(end, std::string::npos);
+  EXPECT_LT(begin, end);
+
+  // Everything from the frame, including the cursor, is inside.
+  EXPECT_EQ(output.substr(end - 6, 6), "\x1B[?25l"sv);
+#endif
+}
+
+TEST(ScreenInteractive, DropFramesWhileTerminalIsBusy) {
+#if defined(__unix__)
+  // The frames are written to a pseudo terminal.
+  const int master = posix_openpt(O_RDWR | O_NOCTTY);
+  ASSERT_GE(master, 0);
+  ASSERT_EQ(grantpt(master), 0);
+  ASSERT_EQ(unlockpt(master), 0);
+  const std::string slave_name = ptsname(master);
+  const int slave = open(slave_name.c_str(), O_RDWR | O_NOCTTY);
+  ASSERT_GE(slave, 0);
+  fflush(stdout);
+  const int old_stdout = dup(fileno(stdout));
+  dup2(slave, fileno(stdout));
+  fcntl(master, F_SETFL, O_NONBLOCK);
+
+  // Read everything the terminal would have received so far.
+  std::string output;
+  auto drain = [&] {
+    std::array<char, 1024> buffer;
+    ssize_t count = 0;
+    while ((count = read(master, buffer.data(), buffer.size())) > 0) {
+      output.append(buffer.data(), count);
+    }
+  };
+
+  {
+    auto screen = ScreenInteractive::FixedSize(2, 1);
+    std::string content = "AB";
+    auto component = Renderer([&] { return text(content); });
+    Loop loop(&screen, component);
+
+    // Simulate a busy terminal, by filling its buffer.
+    const int filler_fd =
+        open(slave_name.c_str(), O_WRONLY | O_NOCTTY | O_NONBLOCK);
+    ASSERT_GE(filler_fd, 0);
+    const std::string filler(1024, '.');
+    while (write(filler_fd, filler.data(), filler.size()) > 0) {
+    }
+    while (write(filler_fd, filler.data(), 1) > 0) {
+    }
+    close(filler_fd);
+
+    // stdout itself stays blocking.
+    EXPECT_EQ(fcntl(fileno(stdout), F_GETFL) & O_NONBLOCK, 0);
+
+    // The first frame can't be fully written. The next ones are dropped.
+    loop.RunOnce();
+    content = "CD";
+    screen.PostEvent(Event::Custom);
+    loop.RunOnce();
+    content = "EF";
+    screen.PostEvent(Event::Custom);
+    loop.RunOnce();
+    EXPECT_EQ(screen.DroppedFrameCount(), 2u);
+
+    // Once the terminal catches up, only the latest state is drawn.
+    drain();
+    loop.RunOnce();
+    drain();
+    EXPECT_EQ(screen.DroppedFrameCount(), 2u);
+  }
+
+  fflush(stdout);
+  dup2(old_stdout, fileno(stdout));
+  close(old_stdout);
+  drain();
+  close(slave);
+  close(master);
+
+  EXPECT_NE(output.find("AB"), std::string::npos);
+  EXPECT_EQ(output.find("CD"), std::string::npos);
+  EXPECT_NE(output.find("EF"), std::string::npos);
+#endif
+}
+
 }  // namespace ftxui
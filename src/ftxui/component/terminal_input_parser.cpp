@@ -161,6 +161,13 @@ void TerminalInputParser::Send(TerminalInputParser::Output output) {
       out_(Event::CursorShape(std::move(pending_), output.cursor_shape));
       pending_.clear();
       return;
+
+    case MODE_REPORT:
+      out_(Event::ModeReport(std::move(pending_),          // NOLINT
+                             output.mode_report.mode,      // NOLINT
+                             output.mode_report.status));  // NOLINT
+      pending_.clear();
+      return;
   }
   // NOT_REACHED().
 }
@@ -374,6 +381,8 @@ TerminalInputParser::Output TerminalInputParser::ParseCSI() {
           return ParseMouse(altered, false, std::move(arguments));
         case 'R':
           return ParseCursorPosition(std::move(arguments));
+        case 'y':
+          return ParseModeReport(std::move(arguments));
         default:
           return SPECIAL;
       }
@@ -461,4 +470,17 @@ TerminalInputParser::Output TerminalInputParser::ParseCursorPosition(
   return output;
 }
 
+// CSI ? mode ; status $ y
+// NOLINTNEXTLINE
+TerminalInputParser::Output TerminalInputParser::ParseModeReport(
+    std::vector<int> arguments) {
+  if (arguments.size() != 2) {
+    return SPECIAL;
+  }
+  Output output(MODE_REPORT);
+  output.mode_report.mode = arguments[0];    // NOLINT
+  output.mode_report.status = arguments[1];  // NOLINT
+  return output;
+}
+
 }  // namespace ftxui
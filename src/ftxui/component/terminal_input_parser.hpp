@@ -31,6 +31,7 @@ class TerminalInputParser {
     MOUSE,
     CURSOR_POSITION,
     CURSOR_SHAPE,
+    MODE_REPORT,
     SPECIAL,
   };
 
@@ -39,12 +40,18 @@ class TerminalInputParser {
     int y;
   };
 
+  struct ModeReport {
+    int mode;
+    int status;
+  };
+
   struct Output {
     Type type;
     union {
       Mouse mouse;
       CursorPosition cursor{};
       int cursor_shape;
+      ModeReport mode_report;
     };
 
     Output(Type t)  // NOLINT
@@ -60,6 +67,7 @@ class TerminalInputParser {
   Output ParseOSC();
   Output ParseMouse(bool altered, bool pressed, std::vector<int> arguments);
   Output ParseCursorPosition(std::vector<int> arguments);
+  Output ParseModeReport(std::vector<int> arguments);
 
   std::function<void(Event)> out_;
   int position_ = -1;
@@ -5,6 +5,7 @@
 #include <functional>                 // for function
 #include <initializer_list>           // for initializer_list
 #include <memory>                     // for allocator, unique_ptr
+#include <string>                     // for string
 #include <vector>                     // for vector
 
 #include "ftxui/component/event.hpp"  // for Event, Event::Return, Event::ArrowDown, Event::ArrowLeft, Event::ArrowRight, Event::ArrowUp, Event::Backspace, Event::End, Event::Home, Event::Custom, Event::Delete, Event::F1, Event::F10, Event::F11, Event::F12, Event::F2, Event::F3, Event::F4, Event::F5, Event::F6, Event::F7, Event::F8, Event::F9, Event::PageDown, Event::PageUp, Event::Tab, Event::TabReverse, Event::Escape
@@ -468,5 +469,19 @@ TEST(Event, DeviceControlString) {
   EXPECT_EQ(1, received_events[0].cursor_shape());
 }
 
+TEST(Event, ModeReport) {
+  std::vector<Event> received_events;
+  auto parser = TerminalInputParser(
+      [&](Event event) { received_events.push_back(std::move(event)); });
+  for (char c : std::string("\x1B[?2026;2$y")) {
+    parser.Add(c);
+  }
+
+  EXPECT_EQ(1, received_events.size());
+  EXPECT_TRUE(received_events[0].is_mode_report());
+  EXPECT_EQ(2026, received_events[0].mode());
+  EXPECT_EQ(2, received_events[0].mode_status());
+}
+
 }  // namespace ftxui
    // NOLINTEND
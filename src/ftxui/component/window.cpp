@@ -9,6 +9,7 @@
 #include <ftxui/component/screen_interactive.hpp>  // for ScreenInteractive
 #include <memory>
 #include <utility>
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
 #include "ftxui/dom/elements.hpp"  // for text, window, hbox, vbox, size, clear_under, reflect, emptyElement
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
 #include "ftxui/screen/color.hpp"        // for Color
@@ -102,7 +103,7 @@ Element DefaultRenderState(const WindowRenderState& state) {
 
   const Color color = Color::Red;
 
-  element = std::make_shared<ResizeDecorator>(  //
+  element = MakeElement<ResizeDecorator>(  //
       element,                                  //
       state.hover_left,                         //
       state.hover_right,                        //
@@ -4,10 +4,13 @@
 export module ftxui.dom;
 
 export import ftxui.dom.canvas;
+export import ftxui.dom.data_table;
 export import ftxui.dom.deprecated;
 export import ftxui.dom.direction;
+export import ftxui.dom.element_arena;
 export import ftxui.dom.elements;
 export import ftxui.dom.flexbox_config;
+export import ftxui.dom.layout_cache;
 export import ftxui.dom.linear_gradient;
 export import ftxui.dom.node;
 export import ftxui.dom.requirement;
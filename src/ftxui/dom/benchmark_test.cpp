@@ -3,7 +3,10 @@
 // the LICENSE file.
 #include <benchmark/benchmark.h>
 
-#include "ftxui/dom/elements.hpp"  // for gauge, separator, operator|, text, Element, hbox, vbox, blink, border, inverted
+#include <string>  // for to_string
+
+#include "ftxui/dom/elements.hpp"  // for gauge, separator, operator|, text, Element, hbox, vbox, blink, border, inverted, flexbox
+#include "ftxui/dom/flexbox_config.hpp"  // for FlexboxConfig
 #include "ftxui/dom/node.hpp"      // for Render
 #include "ftxui/screen/screen.hpp"  // for Screen
 
@@ -82,5 +85,47 @@ BENCHMARK(BenchmarkStyle)
         benchmark::CreateDenseRange(10, 200, 20),  // Screen width.
     });
 
+namespace {
+Elements FlexboxItems(int count) {
+  Elements elements;
+  elements.reserve(count);
+  for (int i = 0; i < count; ++i) {
+    elements.push_back(text(std::to_string(i)));
+  }
+  return elements;
+}
+
+void BenchmarkFlexbox(benchmark::State& state, FlexboxConfig config) {
+  while (state.KeepRunning()) {
+    auto document = flexbox(FlexboxItems(state.range(0)), config);
+    Screen screen(200, 200);
+    Render(screen, document);
+  }
+}
+}  // namespace
+
+static void BenchmarkFlexboxWrap(benchmark::State& state) {
+  BenchmarkFlexbox(state, FlexboxConfig().SetGap(1, 0));
+}
+BENCHMARK(BenchmarkFlexboxWrap)->RangeMultiplier(4)->Range(64, 16384);
+
+static void BenchmarkFlexboxJustify(benchmark::State& state) {
+  BenchmarkFlexbox(state, FlexboxConfig().SetGap(1, 0).Set(
+                              FlexboxConfig::JustifyContent::SpaceBetween));
+}
+BENCHMARK(BenchmarkFlexboxJustify)->RangeMultiplier(4)->Range(64, 16384);
+
+static void BenchmarkFlexboxAlignContent(benchmark::State& state) {
+  BenchmarkFlexbox(state, FlexboxConfig().SetGap(1, 1).Set(
+                              FlexboxConfig::AlignContent::SpaceAround));
+}
+BENCHMARK(BenchmarkFlexboxAlignContent)->RangeMultiplier(4)->Range(64, 16384);
+
+static void BenchmarkFlexboxColumn(benchmark::State& state) {
+  BenchmarkFlexbox(state,
+                   FlexboxConfig().Set(FlexboxConfig::Direction::Column));
+}
+BENCHMARK(BenchmarkFlexboxColumn)->RangeMultiplier(4)->Range(64, 16384);
+
 }  // namespace ftxui
 // NOLINTEND
@@ -11,13 +11,16 @@
 #include <functional>              // for function
 #include <map>                     // for map
 #include <memory>                  // for make_shared
+#include <string>                  // for string
 #include <utility>                 // for move, pair
 #include <vector>                  // for vector
 
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
 #include "ftxui/dom/elements.hpp"     // for Element, canvas
 #include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/glyph.hpp"     // for Glyph
 #include "ftxui/screen/image.hpp"     // for Image
 #include "ftxui/screen/pixel.hpp"     // for Pixel
 #include "ftxui/screen/screen.hpp"    // for Pixel, Screen
@@ -144,8 +147,10 @@ void Canvas::DrawPointOn(int x, int y) {
     cell.type = CellType::kBraille;
   }
 
-  cell.content.character[1] |= g_map_braille[x % 2][y % 4][0];  // NOLINT
-  cell.content.character[2] |= g_map_braille[x % 2][y % 4][1];  // NOLINT
+  std::string braille = cell.content.character;
+  braille[1] |= g_map_braille[x % 2][y % 4][0];  // NOLINT
+  braille[2] |= g_map_braille[x % 2][y % 4][1];  // NOLINT
+  cell.content.character = Glyph(braille, 1);
 }
 
 /// @brief Erase a braille dot.
@@ -161,8 +166,10 @@ void Canvas::DrawPointOff(int x, int y) {
     cell.type = CellType::kBraille;
   }
 
-  cell.content.character[1] &= ~(g_map_braille[x % 2][y % 4][0]);  // NOLINT
-  cell.content.character[2] &= ~(g_map_braille[x % 2][y % 4][1]);  // NOLINT
+  std::string braille = cell.content.character;
+  braille[1] &= ~(g_map_braille[x % 2][y % 4][0]);  // NOLINT
+  braille[2] &= ~(g_map_braille[x % 2][y % 4][1]);  // NOLINT
+  cell.content.character = Glyph(braille, 1);
 }
 
 /// @brief Toggle a braille dot. A filled one will be erased, and the other will
@@ -179,8 +186,10 @@ void Canvas::DrawPointToggle(int x, int y) {
     cell.type = CellType::kBraille;
   }
 
-  cell.content.character[1] ^= g_map_braille[x % 2][y % 4][0];  // NOLINT
-  cell.content.character[2] ^= g_map_braille[x % 2][y % 4][1];  // NOLINT
+  std::string braille = cell.content.character;
+  braille[1] ^= g_map_braille[x % 2][y % 4][0];  // NOLINT
+  braille[2] ^= g_map_braille[x % 2][y % 4][1];  // NOLINT
+  cell.content.character = Glyph(braille, 1);
 }
 
 /// @brief Draw a line made of braille dots.
@@ -479,7 +488,7 @@ void Canvas::DrawBlockOn(int x, int y) {
   const uint8_t bit = (x % 2) * 2 + y % 2;
   uint8_t value = g_map_block_inversed.at(cell.content.character);
   value |= 1U << bit;
-  cell.content.character = g_map_block[value];
+  cell.content.character = Glyph(g_map_block[value], 1);
 }
 
 /// @brief Erase a block.
@@ -499,7 +508,7 @@ void Canvas::DrawBlockOff(int x, int y) {
   const uint8_t bit = (y % 2) * 2 + x % 2;
   uint8_t value = g_map_block_inversed.at(cell.content.character);
   value &= ~(1U << bit);
-  cell.content.character = g_map_block[value];
+  cell.content.character = Glyph(g_map_block[value], 1);
 }
 
 /// @brief Toggle a block. If it is filled, it will be erased. If it is empty,
@@ -520,7 +529,7 @@ void Canvas::DrawBlockToggle(int x, int y) {
   const uint8_t bit = (y % 2) * 2 + x % 2;
   uint8_t value = g_map_block_inversed.at(cell.content.character);
   value ^= 1U << bit;
-  cell.content.character = g_map_block[value];
+  cell.content.character = Glyph(g_map_block[value], 1);
 }
 
 /// @brief Draw a line made of block characters.
@@ -898,7 +907,7 @@ Element canvas(ConstRef<Canvas> canvas) {
     const Canvas& canvas() final { return *canvas_; }
     ConstRef<Canvas> canvas_;
   };
-  return std::make_shared<Impl>(canvas);
+  return MakeElement<Impl>(canvas);
 }
 
 /// @brief Produce an element drawing a canvas of requested size.
@@ -930,7 +939,7 @@ Element canvas(int width, int height, std::function<void(Canvas&)> fn) {
     int height_;
     std::function<void(Canvas&)> fn_;
   };
-  return std::make_shared<Impl>(width, height, std::move(fn));
+  return MakeElement<Impl>(width, height, std::move(fn));
 }
 
 /// @brief Produce an element drawing a canvas.
@@ -4,10 +4,12 @@
 #include <memory>   // for make_shared
 #include <utility>  // for move
 
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
 #include "ftxui/dom/elements.hpp"        // for Element, clear_under
 #include "ftxui/dom/node.hpp"            // for Node
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
 #include "ftxui/screen/box.hpp"          // for Box
+#include "ftxui/screen/pixel.hpp"        // for Pixel
 #include "ftxui/screen/screen.hpp"       // for Pixel, Screen
 
 namespace ftxui {
@@ -20,10 +22,11 @@ class ClearUnder : public NodeDecorator {
   using NodeDecorator::NodeDecorator;
 
   void Render(Screen& screen) override {
+    Pixel cleared;
+    cleared.character = " ";  // Consider the pixel written.
     for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y) = Pixel();
-        screen.PixelAt(x, y).character = " ";  // Consider the pixel written.
+      for (Pixel& pixel : screen.RowAt(y, box_.x_min, box_.x_max)) {
+        pixel = cleared;
       }
     }
     Node::Render(screen);
@@ -36,7 +39,7 @@ class ClearUnder : public NodeDecorator {
 /// @see ftxui::dbox
 /// @ingroup dom
 Element clear_under(Element element) {
-  return std::make_shared<ClearUnder>(std::move(element));
+  return MakeElement<ClearUnder>(std::move(element));
 }
 
 }  // namespace ftxui
@@ -1,72 +1,15 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <memory>   // for make_shared
 #include <utility>  // for move
 
 #include "ftxui/dom/elements.hpp"  // for Element, Decorator, bgcolor, color
-#include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
-#include "ftxui/screen/box.hpp"          // for Box
-#include "ftxui/screen/color.hpp"        // for Color
-#include "ftxui/screen/screen.hpp"       // for Pixel, Screen
+#include "ftxui/dom/style_decorator.hpp"  // for StyleDecorator
+#include "ftxui/screen/color.hpp"         // for Color
+#include "ftxui/screen/pixel.hpp"         // for PixelStyle
 
 namespace ftxui {
 
-namespace {
-class BgColor : public NodeDecorator {
- public:
-  BgColor(Element child, Color color)
-      : NodeDecorator(std::move(child)), color_(color) {}
-
-  void Render(Screen& screen) override {
-    if (color_.IsOpaque()) {
-      for (int y = box_.y_min; y <= box_.y_max; ++y) {
-        for (int x = box_.x_min; x <= box_.x_max; ++x) {
-          screen.PixelAt(x, y).background_color = color_;
-        }
-      }
-    } else {
-      for (int y = box_.y_min; y <= box_.y_max; ++y) {
-        for (int x = box_.x_min; x <= box_.x_max; ++x) {
-          Color& color = screen.PixelAt(x, y).background_color;
-          color = Color::Blend(color, color_);
-        }
-      }
-    }
-    NodeDecorator::Render(screen);
-  }
-
-  Color color_;
-};
-
-class FgColor : public NodeDecorator {
- public:
-  FgColor(Element child, Color color)
-      : NodeDecorator(std::move(child)), color_(color) {}
-
-  void Render(Screen& screen) override {
-    if (color_.IsOpaque()) {
-      for (int y = box_.y_min; y <= box_.y_max; ++y) {
-        for (int x = box_.x_min; x <= box_.x_max; ++x) {
-          screen.PixelAt(x, y).foreground_color = color_;
-        }
-      }
-    } else {
-      for (int y = box_.y_min; y <= box_.y_max; ++y) {
-        for (int x = box_.x_min; x <= box_.x_max; ++x) {
-          Color& color = screen.PixelAt(x, y).foreground_color;
-          color = Color::Blend(color, color_);
-        }
-      }
-    }
-    NodeDecorator::Render(screen);
-  }
-
-  Color color_;
-};
-
-}  // namespace
-
 /// @brief Set the foreground color of an element.
 /// @param color The color of the output element.
 /// @param child The input element.
@@ -79,7 +22,9 @@ class FgColor : public NodeDecorator {
 /// Element document = color(Color::Green, text("Success")),
 /// ```
 Element color(Color color, Element child) {
-  return std::make_shared<FgColor>(std::move(child), color);
+  PixelStyle style;
+  style.foreground_color = color;
+  return StyleDecorator::Make(std::move(child), style, {});
 }
 
 /// @brief Set the background color of an element.
@@ -94,7 +39,9 @@ Element color(Color color, Element child) {
 /// Element document = bgcolor(Color::Green, text("Success")),
 /// ```
 Element bgcolor(Color color, Element child) {
-  return std::make_shared<BgColor>(std::move(child), color);
+  PixelStyle style;
+  style.background_color = color;
+  return StyleDecorator::Make(std::move(child), style, {});
 }
 
 /// @brief Decorate using a foreground color.
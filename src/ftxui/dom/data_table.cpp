@@ -0,0 +1,639 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/dom/data_table.hpp"
+
+#include <algorithm>    // for max, min, upper_bound
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint32_t
+#include <functional>   // for function
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <utility>      // for move, swap
+#include <vector>       // for vector
+
+#include "ftxui/dom/box_helper.hpp"     // for Element, Compute
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
+#include "ftxui/dom/elements.hpp"       // for Element, BorderStyle
+#include "ftxui/dom/node.hpp"           // for Node
+#include "ftxui/dom/requirement.hpp"    // for Requirement
+#include "ftxui/dom/selection.hpp"      // for Selection
+#include "ftxui/screen/box.hpp"         // for Box
+#include "ftxui/screen/pixel.hpp"       // for Pixel, PixelStyle
+#include "ftxui/screen/screen.hpp"      // for Screen
+#include "ftxui/screen/string.hpp"      // for string_width
+#include "ftxui/screen/string_internal.hpp"  // for Utf8ToGlyphEnds
+
+namespace ftxui {
+namespace {
+
+// NOLINTNEXTLINE
+static std::string charset[6][6] = {
+    {"┌", "┐", "└", "┘", "─", "│"},  // LIGHT
+    {"┏", "┓", "┗", "┛", "╍", "╏"},  // DASHED
+    {"┏", "┓", "┗", "┛", "━", "┃"},  // HEAVY
+    {"╔", "╗", "╚", "╝", "═", "║"},  // DOUBLE
+    {"╭", "╮", "╰", "╯", "─", "│"},  // ROUNDED
+    {" ", " ", " ", " ", " ", " "},  // EMPTY
+};
+
+int Wrap(int input, int modulo) {
+  if (modulo == 0) {
+    return 0;
+  }
+  input %= modulo;
+  input += modulo;
+  input %= modulo;
+  return input;
+}
+
+void Order(int& a, int& b) {
+  if (a >= b) {
+    std::swap(a, b);
+  }
+}
+
+}  // namespace
+
+// The table, laid out on a grid of (2 * columns + 1) x (2 * rows + 1)
+// positions, like the gridbox built by `Table`. The cells are read only for
+// the visible rows.
+class DataTable::Grid : public Node {
+ public:
+  explicit Grid(DataTable& table)
+      : dim_x_(2 * table.columns_ + 1),
+        dim_y_(2 * table.rows_ + 1),
+        cell_(std::move(table.cell_)),
+        column_widths_(std::move(table.column_widths_)),
+        lines_(std::move(table.lines_)),
+        styles_(std::move(table.styles_)) {}
+
+  void ComputeRequirement() override {
+    if (widths_.empty()) {
+      Measure();
+    }
+    selected_.clear();
+    requirement_ = Requirement{};
+    for (const int width : widths_) {
+      requirement_.min_x += width;
+    }
+    requirement_.min_y = row_y_.back();
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+
+    // The cells shrink when the table doesn't fit, the lines don't.
+    elements_.resize(widths_.size());
+    for (size_t x = 0; x < widths_.size(); ++x) {
+      elements_[x] = box_helper::Element{};
+      elements_[x].min_size = widths_[x];
+      elements_[x].flex_shrink = int(x % 2);
+    }
+    box_helper::Compute(&elements_, box.x_max - box.x_min + 1);
+
+    column_x_.resize(widths_.size() + 1);
+    column_x_[0] = 0;
+    for (size_t x = 0; x < widths_.size(); ++x) {
+      column_x_[x + 1] = column_x_[x] + elements_[x].size;
+    }
+  }
+
+  void Render(Screen& screen) override {
+    const Box box = Box::Intersection(screen.stencil, box_);
+    if (box.IsEmpty()) {
+      return;
+    }
+
+    // The selected ranges are sorted like the cells below.
+    auto selected = selected_.begin();
+
+    // The first position of the grid intersecting the visible lines.
+    const auto first =
+        std::upper_bound(row_y_.begin(), row_y_.end(), box.y_min - box_.y_min);
+    for (int y = int(first - row_y_.begin()) - 1; y < dim_y_; ++y) {
+      const int y_min = box_.y_min + row_y_[size_t(y)];
+      const int y_max = box_.y_min + row_y_[size_t(y) + 1] - 1;
+      if (y_min > box.y_max) {
+        break;
+      }
+      if (y_min > y_max) {
+        continue;
+      }
+
+      for (int x = 0; x < dim_x_; ++x) {
+        const Box cell = CellBox(x, y);
+        const Box area = Box::Intersection(cell, box);
+        if (area.IsEmpty()) {
+          continue;
+        }
+
+        if (x % 2 == 1 && y % 2 == 1) {
+          while (selected != selected_.end() &&
+                 (selected->y < cell.y_min ||
+                  (selected->y == cell.y_min && selected->end < cell.x_min))) {
+            ++selected;
+          }
+          const bool has_selection = selected != selected_.end() &&
+                                     selected->y == cell.y_min &&
+                                     selected->start <= cell.x_max;
+          DrawCell(screen, area, cell.x_min, x / 2, y / 2,
+                   has_selection ? &*selected : nullptr);
+        } else {
+          DrawLine(screen, area, x, y);
+        }
+
+        for (const StyleOp& op : styles_) {
+          if (Contain(op.area, op.filter, op.modulo, op.shift, x, y)) {
+            screen.ApplyStyle(area, op.style);
+          }
+        }
+      }
+    }
+  }
+
+  void Select(Selection& selection) override {
+    const Box box = Box::Intersection(selection.GetBox(), box_);
+    if (box.IsEmpty()) {
+      return;
+    }
+
+    // Like a `text` element, every cell intersecting the selection contributes
+    // the characters within the selected range.
+    const auto first =
+        std::upper_bound(row_y_.begin(), row_y_.end(), box.y_min - box_.y_min);
+    for (int y = int(first - row_y_.begin()) - 1; y < dim_y_; ++y) {
+      if (box_.y_min + row_y_[size_t(y)] > box.y_max) {
+        break;
+      }
+      if (y % 2 == 0) {
+        continue;
+      }
+
+      for (int x = 1; x < dim_x_; x += 2) {
+        const Box cell = CellBox(x, y);
+        if (cell.IsEmpty() ||
+            Box::Intersection(selection.GetBox(), cell).IsEmpty()) {
+          continue;
+        }
+
+        const Box saturated = selection.SaturateHorizontal(cell).GetBox();
+        std::string text = cell_(y / 2, x / 2);
+        const std::vector<uint32_t> ends = Utf8ToGlyphEnds(text);
+        std::string part;
+        for (int px = saturated.x_min; px <= saturated.x_max; ++px) {
+          const size_t index = size_t(px - cell.x_min);
+          if (index >= ends.size() || px > cell.x_max) {
+            break;
+          }
+          const uint32_t begin = index == 0 ? 0 : ends[index - 1];
+          part += text.substr(begin, size_t(ends[index] - begin));
+        }
+        selection.AddPart(part, cell.y_min, saturated.x_min, saturated.x_max);
+        selected_.push_back({cell.y_min, saturated.x_min, saturated.x_max});
+      }
+    }
+  }
+
+ private:
+  // A range of the screen selected on the row |y|.
+  struct Selected {
+    int y;
+    int start;
+    int end;
+  };
+
+  // The area of the screen of the position (x, y) of the grid.
+  Box CellBox(int x, int y) const {
+    Box cell;
+    cell.x_min = box_.x_min + column_x_[size_t(x)];
+    cell.x_max = box_.x_min + column_x_[size_t(x) + 1] - 1;
+    cell.y_min = box_.y_min + row_y_[size_t(y)];
+    cell.y_max = box_.y_min + row_y_[size_t(y) + 1] - 1;
+    return cell;
+  }
+
+  static bool Contain(const Box& area,
+                      Filter filter,
+                      int modulo,
+                      int shift,
+                      int x,
+                      int y) {
+    if (!area.Contain(x, y)) {
+      return false;
+    }
+    switch (filter) {
+      case Filter::All:
+        return true;
+      case Filter::VerticalLines:
+        return x % 2 == 0;
+      case Filter::HorizontalLines:
+        return y % 2 == 0;
+      case Filter::Lines:
+        return x % 2 == 0 || y % 2 == 0;
+      case Filter::Cells:
+        return x % 2 == 1 && y % 2 == 1;
+      case Filter::AlternateColumn:
+        return y % 2 == 1 && (x / 2) % modulo == shift;
+      case Filter::AlternateRow:
+        return y % 2 == 1 && (y / 2) % modulo == shift;
+      case Filter::AlternateCellColumn:
+        return x % 2 == 1 && y % 2 == 1 && (x / 2) % modulo == shift;
+      case Filter::AlternateCellRow:
+        return x % 2 == 1 && y % 2 == 1 && (y / 2) % modulo == shift;
+    }
+    return false;
+  }
+
+  // The character drawn at the position (x, y) of the grid, if any. The last
+  // operation wins, like the last element assigned to a position of `Table`.
+  const std::string* Line(int x, int y) const {
+    for (auto op = lines_.rbegin(); op != lines_.rend(); ++op) {
+      if (!Contain(op->area, op->filter, 1, 0, x, y)) {
+        continue;
+      }
+      const int glyph = op->glyph != -1 ? op->glyph : (y % 2 == 1 ? 5 : 4);
+      return &charset[op->border][glyph];  // NOLINT
+    }
+    return nullptr;
+  }
+
+  // Compute the width of the columns in a single pass over the cells, and the
+  // height of the rows. The columns whose width is given aren't read. A line
+  // takes space only when it is drawn alongside a cell, a corner alone
+  // doesn't.
+  void Measure() {
+    widths_.assign(size_t(dim_x_), 0);
+    std::vector<int> measured;
+    for (int x = 1; x < dim_x_; x += 2) {
+      const size_t column = size_t(x / 2);
+      if (column < column_widths_.size() && column_widths_[column] >= 0) {
+        widths_[size_t(x)] = column_widths_[column];
+      } else {
+        measured.push_back(x);
+      }
+    }
+
+    std::vector<int> heights(size_t(dim_y_), 0);
+    for (int y = 1; y < dim_y_; y += 2) {
+      heights[size_t(y)] = 1;
+      for (const int x : measured) {
+        int& width = widths_[size_t(x)];
+        width = std::max(width, string_width(cell_(y / 2, x / 2)));
+      }
+    }
+
+    for (const LineOp& op : lines_) {
+      const Box grid = {0, dim_x_ - 1, 0, dim_y_ - 1};
+      const Box area = Box::Intersection(op.area, grid);
+      if (area.IsEmpty()) {
+        continue;
+      }
+      const bool has_odd_x = area.x_min < area.x_max ||  //
+                             area.x_min % 2 == 1;
+      const bool has_odd_y = area.y_min < area.y_max ||  //
+                             area.y_min % 2 == 1;
+      if (has_odd_y && op.filter != Filter::HorizontalLines) {
+        for (int x = area.x_min + area.x_min % 2; x <= area.x_max; x += 2) {
+          widths_[size_t(x)] = 1;
+        }
+      }
+      if (has_odd_x && op.filter != Filter::VerticalLines) {
+        for (int y = area.y_min + area.y_min % 2; y <= area.y_max; y += 2) {
+          heights[size_t(y)] = 1;
+        }
+      }
+    }
+
+    row_y_.resize(size_t(dim_y_) + 1);
+    row_y_[0] = 0;
+    for (size_t y = 0; y < heights.size(); ++y) {
+      row_y_[y + 1] = row_y_[y] + heights[y];
+    }
+  }
+
+  void DrawCell(Screen& screen,
+                const Box& area,
+                int x_start,
+                int column,
+                int row,
+                const Selected* selected) {
+    std::string text = cell_(row, column);
+    const std::vector<uint32_t> ends = Utf8ToGlyphEnds(text);
+    for (int x = area.x_min; x <= area.x_max; ++x) {
+      const size_t index = size_t(x - x_start);
+      if (index >= ends.size()) {
+        break;
+      }
+      const uint32_t begin = index == 0 ? 0 : ends[index - 1];
+      Pixel& pixel = screen.PixelAt(x, area.y_min);
+      pixel.character =
+          std::string_view(text.data() + begin, size_t(ends[index] - begin));
+      if (selected && selected->start <= x && x <= selected->end) {
+        screen.GetSelectionStyle()(pixel);
+      }
+    }
+  }
+
+  void DrawLine(Screen& screen, const Box& area, int x, int y) {
+    const std::string* line = Line(x, y);
+    if (!line) {
+      return;
+    }
+    for (int py = area.y_min; py <= area.y_max; ++py) {
+      for (int px = area.x_min; px <= area.x_max; ++px) {
+        Pixel& pixel = screen.PixelAt(px, py);
+        pixel.character = *line;
+        pixel.automerge = true;
+      }
+    }
+  }
+
+  const int dim_x_;
+  const int dim_y_;
+  const std::function<std::string(int row, int column)> cell_;
+  const std::vector<int> column_widths_;
+  const std::vector<LineOp> lines_;
+  const std::vector<StyleOp> styles_;
+
+  // The width of every column of the grid, and the position of every row.
+  std::vector<int> widths_;
+  std::vector<int> row_y_;
+
+  // The position of every column of the grid, for the current box.
+  std::vector<box_helper::Element> elements_;
+  std::vector<int> column_x_;
+
+  // The ranges of the cells intersecting the selection, sorted by row.
+  std::vector<Selected> selected_;
+};
+
+/// @brief Create an empty table.
+DataTable::DataTable() : DataTable(0, 0, nullptr) {}
+
+/// @brief Create a table from a vector of vector of string.
+/// @param cells The cells, row by row.
+DataTable::DataTable(std::vector<std::vector<std::string>> cells) {
+  rows_ = int(cells.size());
+  for (const auto& row : cells) {
+    columns_ = std::max(columns_, int(row.size()));
+  }
+  cell_ = [cells = std::move(cells)](int row, int column) {
+    const std::vector<std::string>& line = cells[size_t(row)];
+    return size_t(column) < line.size() ? line[size_t(column)] : std::string();
+  };
+}
+
+/// @brief Create a table whose cells are read from a function.
+/// @param rows The number of rows.
+/// @param columns The number of columns.
+/// @param cell Return the string of a cell. It is called once per cell to
+///             compute the width of the columns, unless it is given by
+///             `SetColumnWidth`, then only for the cells drawn.
+DataTable::DataTable(int rows,
+                     int columns,
+                     std::function<std::string(int row, int column)> cell)
+    : rows_(std::max(0, rows)),
+      columns_(std::max(0, columns)),
+      cell_(std::move(cell)) {}
+
+/// @brief Use |width| as the width of the column, instead of reading all its
+/// cells to compute it. The cells wider than |width| are cut.
+/// @param column The index of the column.
+/// @param width The width of the column. A negative width is computed.
+/// @note You can use negative index to select from the end.
+void DataTable::SetColumnWidth(int column, int width) {
+  if (columns_ == 0) {
+    return;
+  }
+  column = Wrap(column, columns_);
+  column_widths_.resize(size_t(columns_), -1);
+  column_widths_[size_t(column)] = width;
+}
+
+/// @brief Select a row of the table.
+/// @param row_index The index of the row to select.
+/// @note You can use negative index to select from the end.
+DataTableSelection DataTable::SelectRow(int row_index) {
+  return SelectRectangle(0, -1, row_index, row_index);
+}
+
+/// @brief Select a range of rows of the table.
+/// @param row_min The first row to select.
+/// @param row_max The last row to select.
+/// @note You can use negative index to select from the end.
+DataTableSelection DataTable::SelectRows(int row_min, int row_max) {
+  return SelectRectangle(0, -1, row_min, row_max);
+}
+
+/// @brief Select a column of the table.
+/// @param column_index The index of the column to select.
+/// @note You can use negative index to select from the end.
+DataTableSelection DataTable::SelectColumn(int column_index) {
+  return SelectRectangle(column_index, column_index, 0, -1);
+}
+
+/// @brief Select a range of columns of the table.
+/// @param column_min The first column to select.
+/// @param column_max The last column to select.
+/// @note You can use negative index to select from the end.
+DataTableSelection DataTable::SelectColumns(int column_min, int column_max) {
+  return SelectRectangle(column_min, column_max, 0, -1);
+}
+
+/// @brief Select a cell of the table.
+/// @param column The column of the cell to select.
+/// @param row The row of the cell to select.
+/// @note You can use negative index to select from the end.
+DataTableSelection DataTable::SelectCell(int column, int row) {
+  return SelectRectangle(column, column, row, row);
+}
+
+/// @brief Select a rectangle of the table.
+/// @param column_min The first column to select.
+/// @param column_max The last column to select.
+/// @param row_min The first row to select.
+/// @param row_max The last row to select.
+/// @note You can use negative index to select from the end.
+DataTableSelection DataTable::SelectRectangle(int column_min,
+                                              int column_max,
+                                              int row_min,
+                                              int row_max) {
+  column_min = Wrap(column_min, columns_);
+  column_max = Wrap(column_max, columns_);
+  Order(column_min, column_max);
+  row_min = Wrap(row_min, rows_);
+  row_max = Wrap(row_max, rows_);
+  Order(row_min, row_max);
+
+  DataTableSelection output;  // NOLINT
+  output.table_ = this;
+  output.x_min_ = 2 * column_min;
+  output.x_max_ = 2 * column_max + 2;
+  output.y_min_ = 2 * row_min;
+  output.y_max_ = 2 * row_max + 2;
+  return output;
+}
+
+/// @brief Select all the table.
+DataTableSelection DataTable::SelectAll() {
+  DataTableSelection output;  // NOLINT
+  output.table_ = this;
+  output.x_min_ = 0;
+  output.x_max_ = 2 * columns_;
+  output.y_min_ = 0;
+  output.y_max_ = 2 * rows_;
+  return output;
+}
+
+/// @brief Render the table.
+/// @return The rendered table. This is an element you can draw.
+/// @note The table is moved into the element. It is empty afterward.
+Element DataTable::Render() {
+  Element element = MakeElement<Grid>(*this);
+  rows_ = 0;
+  columns_ = 0;
+  cell_ = nullptr;
+  column_widths_.clear();
+  lines_.clear();
+  styles_.clear();
+  return element;
+}
+
+/// @brief Apply the `style` to the selection.
+/// This decorate both the cells, the lines and the corners.
+/// @param style The style to apply.
+void DataTableSelection::Decorate(const PixelStyle& style) {
+  const Box area = {x_min_, x_max_, y_min_, y_max_};
+  table_->styles_.push_back({area, DataTable::Filter::All, 1, 0, style});
+}
+
+/// @brief Apply the `style` to the selection.
+/// This decorate only the cells.
+/// @param style The style to apply.
+void DataTableSelection::DecorateCells(const PixelStyle& style) {
+  const Box area = {x_min_, x_max_, y_min_, y_max_};
+  table_->styles_.push_back({area, DataTable::Filter::Cells, 1, 0, style});
+}
+
+/// @brief Apply the `style` to the selection.
+/// This decorate only the columns modulo `modulo` with a shift of `shift`.
+/// @param style The style to apply.
+/// @param modulo The modulo of the columns to decorate.
+/// @param shift The shift of the columns to decorate.
+void DataTableSelection::DecorateAlternateColumn(const PixelStyle& style,
+                                                 int modulo,
+                                                 int shift) {
+  const Box area = {x_min_, x_max_, y_min_, y_max_};
+  table_->styles_.push_back(
+      {area, DataTable::Filter::AlternateColumn, modulo, shift, style});
+}
+
+/// @brief Apply the `style` to the selection.
+/// This decorate only the rows modulo `modulo` with a shift of `shift`.
+/// @param style The style to apply.
+/// @param modulo The modulo of the rows to decorate.
+/// @param shift The shift of the rows to decorate.
+void DataTableSelection::DecorateAlternateRow(const PixelStyle& style,
+                                              int modulo,
+                                              int shift) {
+  const Box area = {x_min_, x_max_, y_min_ + 1, y_max_ - 1};
+  table_->styles_.push_back(
+      {area, DataTable::Filter::AlternateRow, modulo, shift, style});
+}
+
+/// @brief Apply the `style` to the selection.
+/// This decorate only the cells of the columns modulo `modulo` with a shift of
+/// `shift`.
+/// @param style The style to apply.
+/// @param modulo The modulo of the columns to decorate.
+/// @param shift The shift of the columns to decorate.
+void DataTableSelection::DecorateCellsAlternateColumn(const PixelStyle& style,
+                                                      int modulo,
+                                                      int shift) {
+  const Box area = {x_min_, x_max_, y_min_, y_max_};
+  table_->styles_.push_back(
+      {area, DataTable::Filter::AlternateCellColumn, modulo, shift, style});
+}
+
+/// @brief Apply the `style` to the selection.
+/// This decorate only the cells of the rows modulo `modulo` with a shift of
+/// `shift`.
+/// @param style The style to apply.
+/// @param modulo The modulo of the rows to decorate.
+/// @param shift The shift of the rows to decorate.
+void DataTableSelection::DecorateCellsAlternateRow(const PixelStyle& style,
+                                                   int modulo,
+                                                   int shift) {
+  const Box area = {x_min_, x_max_, y_min_, y_max_};
+  table_->styles_.push_back(
+      {area, DataTable::Filter::AlternateCellRow, modulo, shift, style});
+}
+
+/// @brief Apply a `border` around the selection.
+/// @param border The border style to apply.
+void DataTableSelection::Border(BorderStyle border) {
+  BorderLeft(border);
+  BorderRight(border);
+  BorderTop(border);
+  BorderBottom(border);
+
+  auto& lines = table_->lines_;
+  const auto all = DataTable::Filter::All;
+  lines.push_back({{x_min_, x_min_, y_min_, y_min_}, all, border, 0});
+  lines.push_back({{x_max_, x_max_, y_min_, y_min_}, all, border, 1});
+  lines.push_back({{x_min_, x_min_, y_max_, y_max_}, all, border, 2});
+  lines.push_back({{x_max_, x_max_, y_max_, y_max_}, all, border, 3});
+}
+
+/// @brief Draw some separator lines in the selection.
+/// @param border The border style to apply.
+void DataTableSelection::Separator(BorderStyle border) {
+  const Box area = {x_min_ + 1, x_max_ - 1, y_min_ + 1, y_max_ - 1};
+  table_->lines_.push_back({area, DataTable::Filter::Lines, border, -1});
+}
+
+/// @brief Draw some vertical separator lines in the selection.
+/// @param border The border style to apply.
+void DataTableSelection::SeparatorVertical(BorderStyle border) {
+  const Box area = {x_min_ + 1, x_max_ - 1, y_min_ + 1, y_max_ - 1};
+  table_->lines_.push_back({area, DataTable::Filter::VerticalLines, border, 5});
+}
+
+/// @brief Draw some horizontal separator lines in the selection.
+/// @param border The border style to apply.
+void DataTableSelection::SeparatorHorizontal(BorderStyle border) {
+  const Box area = {x_min_ + 1, x_max_ - 1, y_min_ + 1, y_max_ - 1};
+  table_->lines_.push_back(
+      {area, DataTable::Filter::HorizontalLines, border, 4});
+}
+
+/// @brief Draw some separator lines to the left side of the selection.
+/// @param border The border style to apply.
+void DataTableSelection::BorderLeft(BorderStyle border) {
+  const Box area = {x_min_, x_min_, y_min_, y_max_};
+  table_->lines_.push_back({area, DataTable::Filter::All, border, 5});
+}
+
+/// @brief Draw some separator lines to the right side of the selection.
+/// @param border The border style to apply.
+void DataTableSelection::BorderRight(BorderStyle border) {
+  const Box area = {x_max_, x_max_, y_min_, y_max_};
+  table_->lines_.push_back({area, DataTable::Filter::All, border, 5});
+}
+
+/// @brief Draw some separator lines to the top side of the selection.
+/// @param border The border style to apply.
+void DataTableSelection::BorderTop(BorderStyle border) {
+  const Box area = {x_min_, x_max_, y_min_, y_min_};
+  table_->lines_.push_back({area, DataTable::Filter::All, border, 4});
+}
+
+/// @brief Draw some separator lines to the bottom side of the selection.
+/// @param border The border style to apply.
+void DataTableSelection::BorderBottom(BorderStyle border) {
+  const Box area = {x_min_, x_max_, y_max_, y_max_};
+  table_->lines_.push_back({area, DataTable::Filter::All, border, 4});
+}
+
+}  // namespace ftxui
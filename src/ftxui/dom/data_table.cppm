@@ -0,0 +1,17 @@
+/// @module ftxui.dom.data_table
+/// @brief Module file for the DataTable class of the Dom module
+
+module;
+
+#include <ftxui/dom/data_table.hpp>
+
+export module ftxui.dom.data_table;
+
+/**
+ * @namespace ftxui
+ * @brief The FTXUI ftxui:: namespace
+ */
+export namespace ftxui {
+    using ftxui::DataTable;
+    using ftxui::DataTableSelection;
+}
@@ -0,0 +1,220 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for string, to_string
+#include <vector>  // for vector
+
+#include "ftxui/dom/data_table.hpp"
+#include "ftxui/dom/elements.hpp"  // for LIGHT, DOUBLE, HEAVY, inverted, yframe
+#include "ftxui/dom/node.hpp"      // for Render
+#include "ftxui/dom/selection.hpp"  // for Selection
+#include "ftxui/dom/table.hpp"
+#include "ftxui/screen/color.hpp"   // for Color
+#include "ftxui/screen/pixel.hpp"   // for PixelStyle
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+const std::vector<std::vector<std::string>> kCells = {
+    {"a", "bb", "c"},
+    {"dddd", "e", "ff"},
+    {"g", "测试", "i"},
+    {"j", "k"},
+};
+
+// Draw the same table using `Table` and `DataTable`.
+template <class Function>
+void ExpectSameAsTable(Function apply, int width = 20, int height = 12) {
+  auto table = Table(kCells);
+  auto data_table = DataTable(kCells);
+  apply(table);
+  apply(data_table);
+
+  Screen expected(width, height);
+  Render(expected, table.Render());
+  Screen screen(width, height);
+  Render(screen, data_table.Render());
+  EXPECT_EQ(screen.ToString(), expected.ToString());
+}
+
+// The characters of the screen, without the styles.
+std::string Characters(Screen& screen) {
+  std::string output;
+  for (int y = 0; y < screen.dimy(); ++y) {
+    for (int x = 0; x < screen.dimx(); ++x) {
+      output += screen.PixelAt(x, y).character;
+    }
+    output += "\n";
+  }
+  return output;
+}
+}  // namespace
+
+TEST(DataTableTest, Empty) {
+  auto table = DataTable();
+  table.SelectAll().Border(LIGHT);
+  Screen screen(5, 2);
+  Render(screen, table.Render());
+  EXPECT_EQ(
+      "     \r\n"
+      "     ",
+      screen.ToString());
+}
+
+TEST(DataTableTest, Basic) {
+  auto table = DataTable(kCells);
+  Screen screen(10, 5);
+  Render(screen, table.Render());
+  EXPECT_EQ(
+      "a   bb  c \r\n"
+      "dddde   ff\r\n"
+      "g   测试i \r\n"
+      "j   k     \r\n"
+      "          ",
+      screen.ToString());
+}
+
+TEST(DataTableTest, SameAsTable) {
+  ExpectSameAsTable([](auto&) {});
+  ExpectSameAsTable([](auto& table) { table.SelectAll().Border(LIGHT); });
+  ExpectSameAsTable([](auto& table) { table.SelectAll().Separator(LIGHT); });
+  ExpectSameAsTable([](auto& table) {
+    table.SelectAll().Border(DOUBLE);
+    table.SelectAll().Separator(LIGHT);
+  });
+  ExpectSameAsTable([](auto& table) {
+    table.SelectAll().SeparatorVertical(HEAVY);
+    table.SelectRow(0).BorderBottom(DOUBLE);
+  });
+  ExpectSameAsTable([](auto& table) {
+    table.SelectAll().SeparatorHorizontal(LIGHT);
+    table.SelectColumn(-1).BorderLeft(HEAVY);
+    table.SelectColumn(0).BorderRight(ROUNDED);
+  });
+  ExpectSameAsTable([](auto& table) {
+    table.SelectAll().Border(ROUNDED);
+    table.SelectRectangle(1, 2, 1, -1).Border(DOUBLE);
+    table.SelectCell(0, 0).BorderTop(HEAVY);
+  });
+}
+
+TEST(DataTableTest, SameAsTableDecorated) {
+  PixelStyle red;
+  red.foreground_color = Color::Red;
+  PixelStyle blue;
+  blue.background_color = Color::Blue;
+  PixelStyle invert;
+  invert.inverted = true;
+
+  auto table = Table(kCells);
+  table.SelectAll().Border(LIGHT);
+  table.SelectAll().Separator(LIGHT);
+  table.SelectRow(0).Decorate(color(Color::Red));
+  table.SelectColumn(1).DecorateCells(inverted);
+  table.SelectAll().DecorateAlternateRow(bgcolor(Color::Blue));
+  table.SelectAll().DecorateCellsAlternateColumn(inverted, 2, 1);
+
+  auto data_table = DataTable(kCells);
+  data_table.SelectAll().Border(LIGHT);
+  data_table.SelectAll().Separator(LIGHT);
+  data_table.SelectRow(0).Decorate(red);
+  data_table.SelectColumn(1).DecorateCells(invert);
+  data_table.SelectAll().DecorateAlternateRow(blue);
+  data_table.SelectAll().DecorateCellsAlternateColumn(invert, 2, 1);
+
+  Screen expected(20, 12);
+  Render(expected, table.Render());
+  Screen screen(20, 12);
+  Render(screen, data_table.Render());
+  EXPECT_EQ(screen.ToString(), expected.ToString());
+}
+
+TEST(DataTableTest, Shrink) {
+  // The cells shrink, the lines don't.
+  auto apply = [](auto& table) {
+    table.SelectAll().Border(LIGHT);
+    table.SelectAll().SeparatorVertical(LIGHT);
+  };
+  ExpectSameAsTable(apply, 10, 6);
+  ExpectSameAsTable(apply, 6, 6);
+}
+
+TEST(DataTableTest, VisibleRows) {
+  int calls = 0;
+  auto table = DataTable(100000, 2, [&](int row, int column) {
+    calls++;
+    return std::to_string(row) + ":" + std::to_string(column);
+  });
+  table.SelectAll().SeparatorVertical(LIGHT);
+
+  PixelStyle style;
+  style.inverted = true;
+  table.SelectRow(50000).DecorateCells(style);
+
+  auto element = table.Render() | focusPosition(0, 50000) | yframe;
+  Screen screen(15, 3);
+  Render(screen, element);
+  EXPECT_EQ(Characters(screen),
+            "49999:0│49999:1\n"
+            "50000:0│50000:1\n"
+            "50001:0│50001:1\n");
+  EXPECT_TRUE(screen.PixelAt(0, 1).inverted);
+  EXPECT_FALSE(screen.PixelAt(7, 1).inverted);
+  EXPECT_FALSE(screen.PixelAt(0, 0).inverted);
+
+  // Every cell is read once to compute the width of the columns, then only the
+  // visible ones are read again.
+  EXPECT_EQ(calls, 200000 + 6);
+}
+
+TEST(DataTableTest, ColumnWidth) {
+  int calls = 0;
+  auto table = DataTable(100000, 2, [&](int row, int column) {
+    calls++;
+    return std::to_string(row) + ":" + std::to_string(column);
+  });
+  table.SetColumnWidth(0, 7);
+  table.SetColumnWidth(-1, 5);
+  table.SelectAll().SeparatorVertical(LIGHT);
+
+  auto element = table.Render() | focusPosition(0, 50000) | yframe;
+  Screen screen(15, 3);
+  Render(screen, element);
+  EXPECT_EQ(Characters(screen),
+            "49999:0│49999\n"
+            "50000:0│50000\n"
+            "50001:0│50001\n");
+
+  // Only the visible cells are read.
+  EXPECT_EQ(calls, 6);
+}
+
+TEST(DataTableTest, Selection) {
+  auto table = DataTable(kCells);
+  table.SelectAll().Border(LIGHT);
+  table.SelectAll().Separator(LIGHT);
+  auto element = table.Render();
+
+  // From "bb" to "测试", in the second column.
+  Selection selection(6, 1, 8, 5);
+  Screen screen(20, 12);
+  Render(screen, element.get(), selection);
+  EXPECT_EQ(selection.GetParts(), "bb\ne\n测试");
+
+  // Only the characters of the cells are highlighted.
+  EXPECT_TRUE(screen.PixelAt(6, 1).inverted);
+  EXPECT_TRUE(screen.PixelAt(7, 1).inverted);
+  EXPECT_FALSE(screen.PixelAt(8, 1).inverted);
+  EXPECT_FALSE(screen.PixelAt(5, 1).inverted);
+  EXPECT_FALSE(screen.PixelAt(1, 1).inverted);
+  EXPECT_TRUE(screen.PixelAt(6, 3).inverted);
+  EXPECT_FALSE(screen.PixelAt(1, 3).inverted);
+  EXPECT_TRUE(screen.PixelAt(6, 5).inverted);
+  EXPECT_FALSE(screen.PixelAt(6, 7).inverted);
+}
+
+}  // namespace ftxui
+// NOLINTEND
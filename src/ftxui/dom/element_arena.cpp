@@ -0,0 +1,122 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/dom/element_arena.hpp"
+
+#include <algorithm>  // for max, min
+#include <atomic>     // for atomic
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uintptr_t
+#include <memory>     // for unique_ptr
+#include <vector>     // for vector
+
+namespace ftxui {
+
+namespace {
+// The arena used by the current thread.
+thread_local ElementArena* g_arena = nullptr;  // NOLINT
+}  // namespace
+
+class ElementArena::Pool {
+ public:
+  void* Allocate(size_t size, size_t alignment) {
+    refs_.fetch_add(1, std::memory_order_relaxed);
+    while (true) {
+      if (current_ == chunks_.size()) {
+        const size_t chunk_size = std::max(
+            kMinChunkSize << std::min(chunks_.size(), kMaxChunkShift),
+            size + alignment);
+        chunks_.push_back({std::unique_ptr<char[]>(new char[chunk_size]),
+                           chunk_size});
+      }
+
+      const Chunk& chunk = chunks_[current_];
+      const auto base = reinterpret_cast<uintptr_t>(chunk.data.get());
+      const uintptr_t begin =
+          (base + offset_ + alignment - 1) & ~uintptr_t(alignment - 1);
+      if (begin + size <= base + chunk.size) {
+        offset_ = begin + size - base;
+        return reinterpret_cast<void*>(begin);  // NOLINT
+      }
+
+      current_++;
+      offset_ = 0;
+    }
+  }
+
+  // Drop a reference, from the owner or from an element. The last one
+  // releases the memory.
+  void Release() noexcept {
+    if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete this;  // NOLINT
+    }
+  }
+
+  // Whether the owner holds the only reference.
+  bool Unused() const { return refs_.load(std::memory_order_acquire) == 1; }
+
+  // Reuse the chunks from the start. Only valid when unused.
+  void Rewind() {
+    current_ = 0;
+    offset_ = 0;
+  }
+
+ private:
+  // The chunks double in size, from 16 KiB up to 1 MiB.
+  static constexpr size_t kMinChunkSize = size_t(16) << 10;
+  static constexpr size_t kMaxChunkShift = 6;
+
+  struct Chunk {
+    std::unique_ptr<char[]> data;
+    size_t size;
+  };
+  std::vector<Chunk> chunks_;
+  size_t current_ = 0;
+  size_t offset_ = 0;
+
+  // One for the owning ElementArena, plus one per allocation alive.
+  std::atomic<size_t> refs_{1};
+};
+
+ElementArena::ElementArena() : pool_(new Pool) {}
+
+ElementArena::~ElementArena() {
+  pool_->Release();
+}
+
+/// @brief Start a new frame. The memory is reused when every element of the
+/// previous frames is destroyed. Otherwise, it is kept alive by the remaining
+/// elements, and new memory is used.
+void ElementArena::Reset() {
+  if (pool_->Unused()) {
+    pool_->Rewind();
+    return;
+  }
+  pool_->Release();
+  pool_ = new Pool;
+}
+
+ElementArena::Scope::Scope(ElementArena& arena) : previous_(g_arena) {
+  g_arena = &arena;
+}
+
+ElementArena::Scope::~Scope() {
+  g_arena = previous_;
+}
+
+// static
+ElementArena::Pool* ElementArena::Current() {
+  return g_arena ? g_arena->pool_ : nullptr;
+}
+
+// static
+void* ElementArena::Allocate(Pool* pool, size_t size, size_t alignment) {
+  return pool->Allocate(size, alignment);
+}
+
+// static
+void ElementArena::Deallocate(Pool* pool) noexcept {
+  pool->Release();
+}
+
+}  // namespace ftxui
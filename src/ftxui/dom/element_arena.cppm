@@ -0,0 +1,17 @@
+/// @module ftxui.dom.element_arena
+/// @brief Module file for the ElementArena class of the Dom module
+
+module;
+
+#include <ftxui/dom/element_arena.hpp>
+
+export module ftxui.dom.element_arena;
+
+/**
+ * @namespace ftxui
+ * @brief The FTXUI ftxui:: namespace
+ */
+export namespace ftxui {
+    using ftxui::ElementArena;
+    using ftxui::MakeElement;
+}
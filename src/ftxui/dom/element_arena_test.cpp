@@ -0,0 +1,124 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <memory>  // for unique_ptr
+#include <string>  // for string
+
+#include "ftxui/dom/element_arena.hpp"  // for ElementArena
+#include "ftxui/dom/elements.hpp"       // for text, hbox, border, Element
+#include "ftxui/dom/node.hpp"           // for Render
+#include "ftxui/screen/screen.hpp"      // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+Element Document() {
+  return hbox({
+             text("left"),
+             text("right") | bold,
+         }) |
+         border;
+}
+
+std::string ToString(const Element& element) {
+  Screen screen(11, 3);
+  Render(screen, element);
+  return screen.ToString();
+}
+}  // namespace
+
+TEST(ElementArenaTest, SameOutput) {
+  const std::string expected = ToString(Document());
+
+  ElementArena arena;
+  for (int i = 0; i < 3; ++i) {
+    arena.Reset();
+    const ElementArena::Scope scope(arena);
+    EXPECT_EQ(ToString(Document()), expected);
+  }
+}
+
+TEST(ElementArenaTest, MemoryIsReused) {
+  ElementArena arena;
+  const Node* first = nullptr;
+  {
+    const ElementArena::Scope scope(arena);
+    first = text("a").get();
+  }
+
+  arena.Reset();
+  {
+    const ElementArena::Scope scope(arena);
+    Element element = text("b");
+    EXPECT_EQ(element.get(), first);
+  }
+}
+
+TEST(ElementArenaTest, ElementOutlivingTheFrame) {
+  ElementArena arena;
+  Element kept;
+  {
+    const ElementArena::Scope scope(arena);
+    kept = Document();
+  }
+
+  // The memory of |kept| is still used. The next frame uses new memory.
+  arena.Reset();
+  {
+    const ElementArena::Scope scope(arena);
+    Element element = Document();
+    EXPECT_NE(element.get(), kept.get());
+  }
+  EXPECT_EQ(ToString(kept), ToString(Document()));
+}
+
+TEST(ElementArenaTest, ElementOutlivingTheArena) {
+  auto arena = std::make_unique<ElementArena>();
+  Element kept;
+  {
+    const ElementArena::Scope scope(*arena);
+    kept = Document();
+  }
+  arena.reset();
+  EXPECT_EQ(ToString(kept), ToString(Document()));
+}
+
+TEST(ElementArenaTest, ManyChunks) {
+  ElementArena arena;
+  const ElementArena::Scope scope(arena);
+  ElementArena::Pool* pool = ElementArena::Current();
+
+  // Every allocation takes most of a chunk. The arena ends up with more than
+  // 64 chunks.
+  const size_t large = (size_t(1) << 19) + 1;
+  for (int i = 0; i < 70; ++i) {
+    EXPECT_NE(ElementArena::Allocate(pool, large, 8), nullptr);
+  }
+
+  // The next chunks are still large, and shared by the small allocations.
+  auto* a = static_cast<char*>(ElementArena::Allocate(pool, 16, 8));
+  auto* b = static_cast<char*>(ElementArena::Allocate(pool, 16, 8));
+  EXPECT_EQ(b, a + 16);
+
+  for (int i = 0; i < 72; ++i) {
+    ElementArena::Deallocate(pool);
+  }
+}
+
+TEST(ElementArenaTest, NestedScopes) {
+  ElementArena outer;
+  ElementArena inner;
+  EXPECT_EQ(ElementArena::Current(), nullptr);
+  const ElementArena::Scope outer_scope(outer);
+  ElementArena::Pool* outer_pool = ElementArena::Current();
+  {
+    const ElementArena::Scope inner_scope(inner);
+    EXPECT_NE(ElementArena::Current(), outer_pool);
+  }
+  EXPECT_EQ(ElementArena::Current(), outer_pool);
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -109,6 +109,7 @@ export namespace ftxui {
     using ftxui::xframe;
     using ftxui::yframe;
     using ftxui::focus;
+    using ftxui::virtualList;
     using ftxui::select;
 
     using ftxui::focusCursorBlock;
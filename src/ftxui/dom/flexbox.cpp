@@ -4,10 +4,10 @@
 #include <algorithm>  // for min, max
 #include <cstddef>    // for size_t
 #include <memory>  // for __shared_ptr_access, shared_ptr, allocator_traits<>::value_type, make_shared
-#include <tuple>   // for ignore
 #include <utility>  // for move, swap
 #include <vector>   // for vector
 
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
 #include "ftxui/dom/elements.hpp"  // for Element, Elements, flexbox, hflow, vflow
 #include "ftxui/dom/flexbox_config.hpp"  // for FlexboxConfig, FlexboxConfig::Direction, FlexboxConfig::Direction::Column, FlexboxConfig::AlignContent, FlexboxConfig::Direction::ColumnInversed, FlexboxConfig::Direction::Row, FlexboxConfig::JustifyContent, FlexboxConfig::Wrap, FlexboxConfig::AlignContent::FlexStart, FlexboxConfig::Direction::RowInversed, FlexboxConfig::JustifyContent::FlexStart, FlexboxConfig::Wrap::Wrap
 #include "ftxui/dom/flexbox_helper.hpp"  // for Block, Global, Compute
@@ -44,6 +44,19 @@ void Normalize(FlexboxConfig::Wrap& wrap) {
   wrap = FlexboxConfig::Wrap::Wrap;
 }
 
+bool SameInput(const flexbox_helper::Block& a, const flexbox_helper::Block& b) {
+  return a.min_size_x == b.min_size_x && a.min_size_y == b.min_size_y &&
+         a.flex_grow_x == b.flex_grow_x && a.flex_grow_y == b.flex_grow_y &&
+         a.flex_shrink_x == b.flex_shrink_x &&
+         a.flex_shrink_y == b.flex_shrink_y;
+}
+
+bool SameRequirement(const Requirement& a, const Requirement& b) {
+  return a.min_x == b.min_x && a.min_y == b.min_y &&
+         a.focused.enabled == b.focused.enabled &&
+         a.focused.box == b.focused.box;
+}
+
 FlexboxConfig Normalize(FlexboxConfig config) {
   Normalize(config.direction);
   Normalize(config.wrap);
@@ -71,40 +84,55 @@ class Flexbox : public Node {
            config_.direction == FlexboxConfig::Direction::ColumnInversed;
   }
 
+  // Lay out the children into |global|. The previous result is kept when
+  // neither the size nor the requirements of the children changed.
   void Layout(flexbox_helper::Global& global,
+              int size_x,
+              int size_y,
               bool compute_requirement = false) {
-    global.blocks.reserve(children_.size());
-    for (auto& child : children_) {
-      flexbox_helper::Block block;
-      block.min_size_x = child->requirement().min_x;
-      block.min_size_y = child->requirement().min_y;
+    bool unchanged = global.blocks.size() == children_.size() &&
+                     global.size_x == size_x && global.size_y == size_y;
+    global.blocks.resize(children_.size());
+    global.size_x = size_x;
+    global.size_y = size_y;
+    for (size_t i = 0; i < children_.size(); ++i) {
+      const Requirement& requirement = children_[i]->requirement();
+      flexbox_helper::Block input;
+      input.min_size_x = requirement.min_x;
+      input.min_size_y = requirement.min_y;
       if (!compute_requirement) {
-        block.flex_grow_x = child->requirement().flex_grow_x;
-        block.flex_grow_y = child->requirement().flex_grow_y;
-        block.flex_shrink_x = child->requirement().flex_shrink_x;
-        block.flex_shrink_y = child->requirement().flex_shrink_y;
+        input.flex_grow_x = requirement.flex_grow_x;
+        input.flex_grow_y = requirement.flex_grow_y;
+        input.flex_shrink_x = requirement.flex_shrink_x;
+        input.flex_shrink_y = requirement.flex_shrink_y;
+      }
+      if (!SameInput(global.blocks[i], input)) {
+        global.blocks[i] = input;
+        unchanged = false;
       }
-      global.blocks.push_back(block);
     }
 
-    flexbox_helper::Compute(global);
+    if (!unchanged) {
+      flexbox_helper::Compute(global);
+    }
   }
 
   void ComputeRequirement() override {
-    requirement_ = Requirement{};
     for (auto& child : children_) {
-      child->ComputeRequirement();
+      child->UpdateRequirement();
     }
-    global_ = flexbox_helper::Global();
+    Measure();
+  }
+
+  // Compute the requirement, for the size |asked_|.
+  void Measure() {
+    requirement_ = Requirement{};
     global_.config = config_normalized_;
     if (IsColumnOriented()) {
-      global_.size_x = 100000;  // NOLINT
-      global_.size_y = asked_;
+      Layout(global_, 100000, asked_, true);  // NOLINT
     } else {
-      global_.size_x = asked_;
-      global_.size_y = 100000;  // NOLINT
+      Layout(global_, asked_, 100000, true);  // NOLINT
     }
-    Layout(global_, true);
 
     if (global_.blocks.empty()) {
       return;
@@ -141,20 +169,24 @@ class Flexbox : public Node {
   void SetBox(Box box) override {
     Node::SetBox(box);
 
+    // The requirement depends on the size asked. Another iteration is only
+    // needed when it changes.
     const int asked_previous = asked_;
     asked_ = std::min(asked_, IsColumnOriented() ? box.y_max - box.y_min + 1
                                                  : box.x_max - box.x_min + 1);
-    need_iteration_ = (asked_ != asked_previous);
+    need_iteration_ = false;
+    if (asked_ != asked_previous) {
+      const Requirement previous = requirement_;
+      Measure();
+      need_iteration_ = !SameRequirement(previous, requirement_);
+    }
 
-    flexbox_helper::Global global;
-    global.config = config_;
-    global.size_x = box.x_max - box.x_min + 1;
-    global.size_y = box.y_max - box.y_min + 1;
-    Layout(global);
+    global_box_.config = config_;
+    Layout(global_box_, box.x_max - box.x_min + 1, box.y_max - box.y_min + 1);
 
     for (size_t i = 0; i < children_.size(); ++i) {
       auto& child = children_[i];
-      auto& b = global.blocks[i];
+      auto& b = global_box_.blocks[i];
 
       Box children_box;
       children_box.x_min = box.x_min + b.x;
@@ -162,10 +194,7 @@ class Flexbox : public Node {
       children_box.x_max = box.x_min + b.x + b.dim_x - 1;
       children_box.y_max = box.y_min + b.y + b.dim_y - 1;
 
-      const Box intersection = Box::Intersection(children_box, box);
-      child->SetBox(intersection);
-
-      need_iteration_ |= (intersection != children_box);
+      child->UpdateBox(Box::Intersection(children_box, box));
     }
   }
 
@@ -180,7 +209,6 @@ class Flexbox : public Node {
                                     ? selection.SaturateVertical(box_)
                                     : selection.SaturateHorizontal(box_);
 
-    size_t i = 0;
     for (auto& line : global_.lines) {
       Box box;
       box.x_min = box_.x_min + line.x;
@@ -198,19 +226,21 @@ class Flexbox : public Node {
                                      ? selection_lines.SaturateHorizontal(box)
                                      : selection_lines.SaturateVertical(box);
 
-      for (auto& block : line.blocks) {
-        std::ignore = block;
-        children_[i]->Select(selection_line);
-        i++;
+      for (int i = line.begin; i < line.end; ++i) {
+        children_[size_t(i)]->Select(selection_line);
       }
     }
   }
 
   void Check(Status* status) override {
     for (auto& child : children_) {
-      child->Check(status);
+      child->CheckLayout(status);
     }
 
+    // The first pass measures the requirement for an unbounded size, since the
+    // box isn't known yet. SetBox() measures it again for the size given, and
+    // only asks for a second pass when it differs, e.g. when the items wrap
+    // on more lines. That pass reuses the layout of the children.
     if (status->iteration == 0) {
       asked_ = 6000;  // NOLINT
       need_iteration_ = true;
@@ -223,7 +253,11 @@ class Flexbox : public Node {
   bool need_iteration_ = true;
   const FlexboxConfig config_;
   const FlexboxConfig config_normalized_;
+
+  // The layout computing the requirement, and the one drawn. They are reused
+  // across iterations and calls.
   flexbox_helper::Global global_;
+  flexbox_helper::Global global_box_;
 };
 
 }  // namespace
@@ -249,7 +283,7 @@ class Flexbox : public Node {
 /// )
 /// ```
 Element flexbox(Elements children, FlexboxConfig config) {
-  return std::make_shared<Flexbox>(std::move(children), config);
+  return MakeElement<Flexbox>(std::move(children), config);
 }
 
 /// @brief A container displaying elements in rows from left to right. When
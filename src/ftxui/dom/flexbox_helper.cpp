@@ -95,30 +95,32 @@ void SymmetryY(Global& g) {
 }
 
 void SetX(Global& global) {
+  auto& elements = global.elements;
   for (auto& line : global.lines) {
-    std::vector<box_helper::Element> elements;
-    elements.reserve(line.blocks.size());
-    for (auto* block : line.blocks) {
+    elements.clear();
+    for (int i = line.begin; i < line.end; ++i) {
+      const Block& block = global.blocks[i];
       box_helper::Element element;
-      element.min_size = block->min_size_x;
+      element.min_size = block.min_size_x;
       element.flex_grow =
-          block->flex_grow_x != 0 || global.config.justify_content ==
-                                         FlexboxConfig::JustifyContent::Stretch
+          block.flex_grow_x != 0 || global.config.justify_content ==
+                                        FlexboxConfig::JustifyContent::Stretch
               ? 1
               : 0;
-      element.flex_shrink = block->flex_shrink_x;
+      element.flex_shrink = block.flex_shrink_x;
       elements.push_back(element);
     }
 
     box_helper::Compute(
         &elements,
-        global.size_x - global.config.gap_x * (int(line.blocks.size()) - 1));
+        global.size_x - global.config.gap_x * (line.end - line.begin - 1));
 
     int x = 0;
-    for (size_t i = 0; i < line.blocks.size(); ++i) {
-      line.blocks[i]->x = x;
-      line.blocks[i]->dim_x = elements[i].size;
-      x += elements[i].size;
+    for (int i = line.begin; i < line.end; ++i) {
+      Block& block = global.blocks[i];
+      block.x = x;
+      block.dim_x = elements[size_t(i - line.begin)].size;
+      x += block.dim_x;
       x += global.config.gap_x;
     }
   }
@@ -131,16 +133,17 @@ void SetX(Global& global) {
 
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
 void SetY(Global& g) {
-  std::vector<box_helper::Element> elements;
-  elements.reserve(g.lines.size());
+  auto& elements = g.elements;
+  elements.clear();
   for (auto& line : g.lines) {
     box_helper::Element element;
-    element.flex_shrink = line.blocks.front()->flex_shrink_y;
-    element.flex_grow = line.blocks.front()->flex_grow_y;
-    for (auto* block : line.blocks) {
-      element.min_size = std::max(element.min_size, block->min_size_y);
-      element.flex_shrink = std::min(element.flex_shrink, block->flex_shrink_y);
-      element.flex_grow = std::min(element.flex_grow, block->flex_grow_y);
+    element.flex_shrink = g.blocks[line.begin].flex_shrink_y;
+    element.flex_grow = g.blocks[line.begin].flex_grow_y;
+    for (int i = line.begin; i < line.end; ++i) {
+      const Block& block = g.blocks[i];
+      element.min_size = std::max(element.min_size, block.min_size_y);
+      element.flex_shrink = std::min(element.flex_shrink, block.flex_shrink_y);
+      element.flex_grow = std::min(element.flex_grow, block.flex_grow_y);
     }
     elements.push_back(element);
   }
@@ -149,7 +152,8 @@ void SetY(Global& g) {
   box_helper::Compute(&elements, 10000);  // NOLINT
 
   // [Align-content]
-  std::vector<int> ys(elements.size());
+  auto& ys = g.ys;
+  ys.resize(elements.size());
   int y = 0;
   for (size_t i = 0; i < elements.size(); ++i) {
     ys[i] = y;
@@ -215,7 +219,8 @@ void SetY(Global& g) {
   // [Align items]
   for (size_t i = 0; i < g.lines.size(); ++i) {
     auto& element = elements[i];
-    for (auto* block : g.lines[i].blocks) {
+    for (int j = g.lines[i].begin; j < g.lines[i].end; ++j) {
+      Block* block = &g.blocks[j];
       const bool stretch =
           block->flex_grow_y != 0 ||
           g.config.align_content == FlexboxConfig::AlignContent::Stretch;
@@ -258,7 +263,8 @@ void SetY(Global& g) {
 
 void JustifyContent(Global& g) {
   for (auto& line : g.lines) {
-    Block* last = line.blocks.back();
+    Block* first = &g.blocks[line.begin];
+    Block* last = &g.blocks[line.end - 1];
     int remaining_space = g.size_x - last->x - last->dim_x;
     switch (g.config.justify_content) {
       case FlexboxConfig::JustifyContent::FlexStart:
@@ -266,38 +272,38 @@ void JustifyContent(Global& g) {
         break;
 
       case FlexboxConfig::JustifyContent::FlexEnd: {
-        for (auto* block : line.blocks) {
+        for (Block* block = first; block <= last; ++block) {
           block->x += remaining_space;
         }
         break;
       }
 
       case FlexboxConfig::JustifyContent::Center: {
-        for (auto* block : line.blocks) {
+        for (Block* block = first; block <= last; ++block) {
           block->x += remaining_space / 2;
         }
         break;
       }
 
       case FlexboxConfig::JustifyContent::SpaceBetween: {
-        for (int i = (int)line.blocks.size() - 1; i >= 1; --i) {
-          line.blocks[i]->x += remaining_space;
+        for (int i = line.end - line.begin - 1; i >= 1; --i) {
+          first[i].x += remaining_space;
           remaining_space = remaining_space * (i - 1) / i;
         }
         break;
       }
 
       case FlexboxConfig::JustifyContent::SpaceAround: {
-        for (int i = (int)line.blocks.size() - 1; i >= 0; --i) {
-          line.blocks[i]->x += remaining_space * (2 * i + 1) / (2 * i + 2);
+        for (int i = line.end - line.begin - 1; i >= 0; --i) {
+          first[i].x += remaining_space * (2 * i + 1) / (2 * i + 2);
           remaining_space = remaining_space * (2 * i) / (2 * i + 2);
         }
         break;
       }
 
       case FlexboxConfig::JustifyContent::SpaceEvenly: {
-        for (int i = (int)line.blocks.size() - 1; i >= 0; --i) {
-          line.blocks[i]->x += remaining_space * (i + 1) / (i + 2);
+        for (int i = line.end - line.begin - 1; i >= 0; --i) {
+          first[i].x += remaining_space * (i + 1) / (i + 2);
           remaining_space = remaining_space * (i + 1) / (i + 2);
         }
         break;
@@ -335,24 +341,28 @@ void Compute3(Global& global) {
   {
     Line line;
     int x = 0;
-    for (auto& block : global.blocks) {
+    const int size = static_cast<int>(global.blocks.size());
+    for (int i = 0; i < size; ++i) {
+      Block& block = global.blocks[i];
       // Does it fit the end of the row?
       // No? Then we need to start a new one:
       if (x + block.min_size_x > global.size_x) {
         x = 0;
-        if (!line.blocks.empty()) {
-          global.lines.push_back(std::move(line));
+        if (line.begin != line.end) {
+          global.lines.push_back(line);
         }
         line = Line();
+        line.begin = i;
+        line.end = i;
       }
 
       block.line = static_cast<int>(global.lines.size());
-      block.line_position = static_cast<int>(line.blocks.size());
-      line.blocks.push_back(&block);
+      block.line_position = line.end - line.begin;
+      line.end++;
       x += block.min_size_x + global.config.gap_x;
     }
-    if (!line.blocks.empty()) {
-      global.lines.push_back(std::move(line));
+    if (line.begin != line.end) {
+      global.lines.push_back(line);
     }
   }
 
@@ -367,6 +377,7 @@ void Compute3(Global& global) {
 }  // namespace
 
 void Compute(Global& global) {
+  global.lines.clear();
   if (global.config.direction == FlexboxConfig::Direction::Column ||
       global.config.direction == FlexboxConfig::Direction::ColumnInversed) {
     SymmetryXY(global);
@@ -5,6 +5,7 @@
 #define FTXUI_DOM_FLEXBOX_HELPER_HPP
 
 #include <vector>
+#include "ftxui/dom/box_helper.hpp"
 #include "ftxui/dom/flexbox_config.hpp"
 
 namespace ftxui::flexbox_helper {
@@ -29,9 +30,10 @@ struct Block {
   bool overflow = false;
 };
 
-// A line is a row of blocks.
+// A line is a row of blocks. It holds the blocks [begin, end).
 struct Line {
-  std::vector<Block*> blocks;
+  int begin = 0;
+  int end = 0;
   int x = 0;
   int y = 0;
   int dim_x = 0;
@@ -44,8 +46,14 @@ struct Global {
   FlexboxConfig config;
   int size_x;
   int size_y;
+
+  // Reused across calls to Compute, to avoid allocations.
+  std::vector<box_helper::Element> elements;
+  std::vector<int> ys;
 };
 
+// Compute the position of the blocks. The lines are computed again. The
+// Global can be reused, only its blocks inputs need to be set.
 void Compute(Global& global);
 
 }  // namespace ftxui::flexbox_helper
@@ -2,11 +2,13 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <gtest/gtest.h>
-#include <string>  // for allocator
+#include <string>   // for allocator, to_string
+#include <utility>  // for move
 
 #include "ftxui/dom/elements.hpp"        // for text, flexbox
 #include "ftxui/dom/flexbox_config.hpp"  // for FlexboxConfig, FlexboxConfig::Direction, FlexboxConfig::AlignContent, FlexboxConfig::JustifyContent, FlexboxConfig::Direction::Column, FlexboxConfig::AlignItems, FlexboxConfig::JustifyContent::SpaceAround, FlexboxConfig::AlignContent::Center, FlexboxConfig::AlignContent::FlexEnd, FlexboxConfig::AlignContent::SpaceAround, FlexboxConfig::AlignContent::SpaceBetween, FlexboxConfig::AlignContent::SpaceEvenly, FlexboxConfig::AlignItems::Center, FlexboxConfig::AlignItems::FlexEnd, FlexboxConfig::Direction::ColumnInversed, FlexboxConfig::Direction::Row, FlexboxConfig::Direction::RowInversed, FlexboxConfig::JustifyContent::Center, FlexboxConfig::JustifyContent::SpaceBetween
-#include "ftxui/dom/node.hpp"            // for Render
+#include "ftxui/dom/node.hpp"            // for Render, LayoutStats
+#include "ftxui/dom/selection.hpp"       // for Selection
 #include "ftxui/screen/screen.hpp"       // for Screen
 
 // NOLINTBEGIN
@@ -457,5 +459,54 @@ TEST(FlexboxTest, Focus) {
             "-");
 }
 
+TEST(FlexboxTest, ManyItems) {
+  Elements elements;
+  for (int i = 0; i < 10000; ++i) {
+    elements.push_back(text(std::to_string(i % 10)));
+  }
+  auto root = flexbox(std::move(elements), FlexboxConfig().SetGap(1, 0));
+
+  // The items overflowing the box don't cause more iterations. The first pass
+  // measures the items on a single line. Once its width is known, the flexbox
+  // requires more lines: the second pass lets the parent take it into
+  // account. Only the flexbox is computed again, its children aren't.
+  Screen screen(7, 2);
+  Selection selection;
+  LayoutStats stats;
+  Render(screen, root.get(), selection, stats);
+  EXPECT_EQ(stats.passes, 2);
+  EXPECT_EQ(stats.recomputed_nodes, 10001 + 1);
+  EXPECT_EQ(screen.ToString(),
+            "0 1 2 3\r\n"
+            "4 5 6 7");
+}
+
+TEST(FlexboxTest, SinglePass) {
+  // The items fit on a single line. Knowing the width doesn't change the
+  // requirement, so no second pass is needed.
+  auto root = flexbox({
+      text("aaa"),
+      text("bbb"),
+  });
+  Screen screen(10, 1);
+  Selection selection;
+  LayoutStats stats;
+  Render(screen, root.get(), selection, stats);
+  EXPECT_EQ(stats.passes, 1);
+  EXPECT_EQ(screen.ToString(), "aaabbb    ");
+}
+
+TEST(FlexboxTest, SelectSecondLine) {
+  auto root = flexbox({
+      text("aaa"),
+      text("bbb"),
+      text("ccc"),
+  });
+  Screen screen(7, 2);
+  Selection selection(0, 1, 2, 1);
+  Render(screen, root.get(), selection);
+  EXPECT_EQ(selection.GetParts(), "ccc");
+}
+
 }  // namespace ftxui
 // NOLINTEND
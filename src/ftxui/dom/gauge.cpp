@@ -5,6 +5,7 @@
 #include <memory>                   // for allocator, make_shared
 #include <string>                   // for string
 
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
 #include "ftxui/dom/elements.hpp"  // for Element, gauge, gaugeDirection, gaugeDown, gaugeLeft, gaugeRight, gaugeUp
 #include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
@@ -108,12 +109,13 @@ class Gauge : public Node {
       const int limit_int = static_cast<int>(limit);
       int x = box_.x_min;
       while (x < limit_int) {
-        screen.at(x++, y) = charset_horizontal[9];  // NOLINT
+        screen.PixelAt(x++, y).character = charset_horizontal[9];  // NOLINT
       }
       // NOLINTNEXTLINE
-      screen.at(x++, y) = charset_horizontal[int(9 * (limit - limit_int))];
+      screen.PixelAt(x++, y).character =
+          charset_horizontal[int(9 * (limit - limit_int))];
       while (x <= box_.x_max) {
-        screen.at(x++, y) = charset_horizontal[0];
+        screen.PixelAt(x++, y).character = charset_horizontal[0];
       }
     }
 
@@ -138,12 +140,13 @@ class Gauge : public Node {
       const int limit_int = static_cast<int>(limit);
       int y = box_.y_min;
       while (y < limit_int) {
-        screen.at(x, y++) = charset_vertical[8];  // NOLINT
+        screen.PixelAt(x, y++).character = charset_vertical[8];  // NOLINT
       }
       // NOLINTNEXTLINE
-      screen.at(x, y++) = charset_vertical[int(8 * (limit - limit_int))];
+      screen.PixelAt(x, y++).character =
+          charset_vertical[int(8 * (limit - limit_int))];
       while (y <= box_.y_max) {
-        screen.at(x, y++) = charset_vertical[0];
+        screen.PixelAt(x, y++).character = charset_vertical[0];
       }
     }
 
@@ -167,7 +170,7 @@ class Gauge : public Node {
 /// @param direction Direction of progress bars progression.
 /// @ingroup dom
 Element gaugeDirection(float progress, Direction direction) {
-  return std::make_shared<Gauge>(progress, direction);
+  return MakeElement<Gauge>(progress, direction);
 }
 
 /// @brief Draw a high definition progress bar progressing from left to right.
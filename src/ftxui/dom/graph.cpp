@@ -7,6 +7,7 @@
 #include <utility>     // for move
 #include <vector>      // for vector
 
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
 #include "ftxui/dom/elements.hpp"     // for GraphFunction, Element, graph
 #include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
@@ -55,7 +56,7 @@ class Graph : public Node {
         const int yy = 2 * y;
         int i_1 = yy < height_1 ? 0 : yy == height_1 ? 3 : 6;  // NOLINT
         int i_2 = yy < height_2 ? 0 : yy == height_2 ? 1 : 2;  // NOLINT
-        screen.at(x, y) = charset[i_1 + i_2];                  // NOLINT
+        screen.PixelAt(x, y).character = charset[i_1 + i_2];  // NOLINT
       }
     }
   }
@@ -69,7 +70,7 @@ class Graph : public Node {
 /// @brief Draw a graph using a GraphFunction.
 /// @param graph_function the function to be called to get the data.
 Element graph(GraphFunction graph_function) {
-  return std::make_shared<Graph>(std::move(graph_function));
+  return MakeElement<Graph>(std::move(graph_function));
 }
 
 }  // namespace ftxui
@@ -2,7 +2,9 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <gtest/gtest.h>  // for Test, EXPECT_EQ, Message, TestPartResult, TestInfo (ptr only), TEST
-#include <string>  // for allocator, string
+#include <cstdint>  // for uint16_t
+#include <string>   // for allocator, string, to_string
+#include <utility>  // for move
 
 #include "ftxui/dom/elements.hpp"  // for text, hyperlink, operator|, Element, hbox
 #include "ftxui/dom/node.hpp"      // for Render
@@ -39,4 +41,48 @@ TEST(HyperlinkTest, Basic) {
             "\x1B]8;;\x1B\\");
 }
 
+TEST(HyperlinkTest, IdsAreKeptAcrossFrames) {
+  Screen screen(1, 1);
+  const uint16_t a = screen.RegisterHyperlink("https://a.com");
+  const uint16_t b = screen.RegisterHyperlink("https://b.com");
+  EXPECT_NE(a, b);
+  EXPECT_EQ(screen.RegisterHyperlink("https://a.com"), a);
+
+  screen.Clear();
+  EXPECT_EQ(screen.RegisterHyperlink("https://b.com"), b);
+  EXPECT_EQ(screen.Hyperlink(a), "https://a.com");
+  EXPECT_EQ(screen.Hyperlink(0), "");
+}
+
+TEST(HyperlinkTest, MoreThan255Links) {
+  auto link = [](int i) { return "https://" + std::to_string(i) + ".com"; };
+  Elements elements;
+  for (int i = 0; i < 1000; ++i) {
+    elements.push_back(text("x") | hyperlink(link(i)));
+  }
+
+  Screen screen(1000, 1);
+  Render(screen, hbox(std::move(elements)));
+
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(screen.Hyperlink(screen.PixelAt(i, 0).hyperlink), link(i));
+  }
+}
+
+TEST(HyperlinkTest, CopyKeepsItsLinks) {
+  Screen screen(1, 1);
+  screen.PixelAt(0, 0).hyperlink = screen.RegisterHyperlink("https://a.com");
+  const Screen copy = screen;
+
+  // Fill the registry, until Clear() replaces it.
+  screen.Clear();
+  for (int i = 0; i < 40000; ++i) {
+    screen.RegisterHyperlink(std::to_string(i));
+  }
+  screen.Clear();
+  EXPECT_EQ(screen.RegisterHyperlink("https://b.com"), 1u);
+
+  EXPECT_EQ(copy.Hyperlink(copy.PixelAt(0, 0).hyperlink), "https://a.com");
+}
+
 }  // namespace ftxui
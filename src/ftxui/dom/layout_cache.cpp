@@ -0,0 +1,300 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/dom/layout_cache.hpp"
+
+#include <cstddef>   // for size_t
+#include <cstdint>   // for uint16_t, uint32_t
+#include <memory>    // for make_shared
+#include <string>    // for string
+#include <utility>   // for move
+#include <vector>    // for vector
+
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
+#include "ftxui/dom/elements.hpp"     // for Element, Decorator, unpack
+#include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/node_layout.hpp"  // for Layout, CurrentRender
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/dom/selection.hpp"    // for Selection
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/glyph.hpp"     // for Glyph
+#include "ftxui/screen/pixel.hpp"     // for Pixel
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+namespace ftxui {
+
+namespace {
+bool SamePixel(const Pixel& a, const Pixel& b) {
+  return a.character == b.character &&                //
+         a.foreground_color == b.foreground_color &&  //
+         a.background_color == b.background_color &&  //
+         a.hyperlink == b.hyperlink &&                //
+         a.blink == b.blink &&                        //
+         a.bold == b.bold &&                          //
+         a.dim == b.dim &&                            //
+         a.italic == b.italic &&                      //
+         a.inverted == b.inverted &&                  //
+         a.underlined == b.underlined &&              //
+         a.underlined_double == b.underlined_double &&
+         a.strikethrough == b.strikethrough && a.automerge == b.automerge;
+}
+
+bool SameRequirement(const Requirement& a, const Requirement& b) {
+  return a.min_x == b.min_x && a.min_y == b.min_y &&
+         a.flex_grow_x == b.flex_grow_x && a.flex_grow_y == b.flex_grow_y &&
+         a.flex_shrink_x == b.flex_shrink_x &&
+         a.flex_shrink_y == b.flex_shrink_y;
+}
+}  // namespace
+
+class LayoutCacheNode : public Node {
+ public:
+  LayoutCacheNode(Element child,
+                  LayoutCache& cache,
+                  std::string key,
+                  size_t hash)
+      : Node(unpack(std::move(child))),
+        cache_(cache),
+        key_(std::move(key)),
+        hash_(hash) {}
+
+  void Check(Status* status) override {
+    cache_.StartFrame(CurrentRender());
+    auto it = cache_.entries_.find(key_);
+    entry_ = (it != cache_.entries_.end() && it->second.hash == hash_)
+                 ? &it->second
+                 : nullptr;
+    if (!entry_) {
+      Node::Check(status);
+      return;
+    }
+    entry_->frame = cache_.frame_;
+
+    // The layout of the child is reused, it doesn't take part in the
+    // iterations. Another one is needed only if its requirement changed.
+    status->need_iteration |= (status->iteration == 0) || requirement_changed_;
+    requirement_changed_ = false;
+  }
+
+  void ComputeRequirement() override {
+    if (entry_) {
+      requirement_ = entry_->requirement;
+      return;
+    }
+    Node::ComputeRequirement();
+    requirement_ = children_[0]->requirement();
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    if (!entry_) {
+      children_[0]->UpdateBox(box);
+      return;
+    }
+
+    // The previous layout is valid for the same box. It is only computed again
+    // if needed to draw the child.
+    child_has_layout_ = false;
+    if (box != entry_->box) {
+      LayoutChild();
+    }
+  }
+
+  void Select(Selection& selection) override {
+    if (Box::Intersection(selection.GetBox(), box_).IsEmpty()) {
+      return;
+    }
+    selected_ = true;
+    if (entry_ && !child_has_layout_) {
+      LayoutChild();
+    }
+    Node::Select(selection);
+  }
+
+  void Render(Screen& screen) override {
+    const bool fully_visible = !box_.IsEmpty() && !selected_ &&
+                               Box::Intersection(screen.stencil, box_) == box_;
+    if (entry_ && entry_->has_cells && entry_->box == box_ && fully_visible &&
+        entry_->generation == Glyph::InternedGeneration() &&
+        SameCells(screen, entry_->below)) {
+      Restore(screen);
+      return;
+    }
+
+    // Keep what is drawn below the child. The cells can only be reused later
+    // if it is unchanged.
+    std::vector<Pixel> below;
+    if (fully_visible) {
+      Copy(screen, below);
+    }
+
+    if (entry_ && !child_has_layout_) {
+      LayoutChild();
+    }
+    Node::Render(screen);
+    Store(screen, std::move(below));
+  }
+
+ private:
+  // Compute the layout of the child alone, for the current box.
+  void LayoutChild() {
+    Layout(children_[0].get(), box_);
+    child_has_layout_ = true;
+
+    // The requirement may depend on the box. If it changed, the parent must
+    // compute its layout again.
+    if (!SameRequirement(entry_->requirement, children_[0]->requirement())) {
+      entry_->requirement = children_[0]->requirement();
+      requirement_ = entry_->requirement;
+      requirement_changed_ = true;
+    }
+  }
+
+  void Copy(const Screen& screen, std::vector<Pixel>& cells) const {
+    cells.clear();
+    cells.reserve(size_t(box_.x_max - box_.x_min + 1) *
+                  size_t(box_.y_max - box_.y_min + 1));
+    for (int y = box_.y_min; y <= box_.y_max; ++y) {
+      for (const Pixel& pixel : screen.RowAt(y, box_.x_min, box_.x_max)) {
+        cells.push_back(pixel);
+      }
+    }
+  }
+
+  bool SameCells(const Screen& screen, const std::vector<Pixel>& cells) const {
+    const Pixel* cell = cells.data();
+    for (int y = box_.y_min; y <= box_.y_max; ++y) {
+      for (const Pixel& pixel : screen.RowAt(y, box_.x_min, box_.x_max)) {
+        if (!SamePixel(pixel, *cell++)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  void Store(Screen& screen, std::vector<Pixel> below) {
+    const Requirement& requirement = children_[0]->requirement();
+    if (requirement.focused.enabled) {
+      // The focused node is referenced by pointer. It can't be reused.
+      cache_.entries_.erase(key_);
+      entry_ = nullptr;
+      return;
+    }
+
+    LayoutCache::Entry& entry = cache_.entries_[key_];
+    entry.hash = hash_;
+    entry.frame = cache_.frame_;
+    entry.requirement = requirement;
+    entry.box = box_;
+    entry.links.clear();
+
+    // Only the cells fully drawn, unselected, can be restored.
+    entry.has_cells = !below.empty();
+    entry.generation = Glyph::InternedGeneration();
+    entry.below = std::move(below);
+    entry.cells.clear();
+    if (!entry.has_cells) {
+      return;
+    }
+
+    entry.cells.reserve(entry.below.size());
+    std::vector<uint16_t> link_index;
+    for (int y = box_.y_min; y <= box_.y_max; ++y) {
+      for (const Pixel& pixel : screen.RowAt(y, box_.x_min, box_.x_max)) {
+        entry.cells.push_back(pixel);
+        if (pixel.hyperlink == 0) {
+          continue;
+        }
+        // Hyperlink ids are specific to the screen. Keep the links instead.
+        if (link_index.size() <= pixel.hyperlink) {
+          link_index.resize(size_t(pixel.hyperlink) + 1, 0);
+        }
+        if (link_index[pixel.hyperlink] == 0) {
+          entry.links.push_back(screen.Hyperlink(pixel.hyperlink));
+          link_index[pixel.hyperlink] = uint16_t(entry.links.size());
+        }
+        entry.cells.back().hyperlink = link_index[pixel.hyperlink];
+      }
+    }
+  }
+
+  void Restore(Screen& screen) {
+    std::vector<uint16_t> link_ids;
+    link_ids.reserve(entry_->links.size() + 1);
+    link_ids.push_back(0);
+    for (const std::string& link : entry_->links) {
+      link_ids.push_back(screen.RegisterHyperlink(link));
+    }
+
+    const Pixel* cell = entry_->cells.data();
+    for (int y = box_.y_min; y <= box_.y_max; ++y) {
+      for (Pixel& pixel : screen.RowAt(y, box_.x_min, box_.x_max)) {
+        pixel = *cell++;
+        pixel.hyperlink = link_ids[pixel.hyperlink];
+      }
+    }
+  }
+
+  LayoutCache& cache_;
+  const std::string key_;
+  const size_t hash_;
+
+  // The entry matching |key_| and |hash_|, if any.
+  LayoutCache::Entry* entry_ = nullptr;
+  bool child_has_layout_ = false;
+  bool requirement_changed_ = false;
+  bool selected_ = false;
+};
+
+void LayoutCache::StartFrame(uint32_t render) {
+  // Outside of Render(), e.g. while computing Dimension::Fit(), the frame
+  // continues.
+  if (render == 0 || render == render_) {
+    return;
+  }
+  render_ = render;
+  frame_++;
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    if (frame_ - it->second.frame > uint64_t(max_unused_frames_)) {
+      it = entries_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+/// @brief Reuse the layout and the drawing of an element from the previous
+/// frames, when it is unchanged.
+/// @param child The element to cache.
+/// @param cache The cache, kept across frames.
+/// @param key Identify the element in the cache. It must be stable across
+///            frames, and unique within the cache.
+/// @param hash Identify the content of the element. It must change whenever
+///             the element would be laid out or drawn differently.
+/// @see LayoutCache
+/// @ingroup dom
+Element cached(Element child,
+               LayoutCache& cache,
+               std::string key,
+               size_t hash) {
+  return MakeElement<LayoutCacheNode>(std::move(child), cache,
+                                           std::move(key), hash);
+}
+
+/// @brief Reuse the layout and the drawing of an element from the previous
+/// frames, when it is unchanged.
+/// @param cache The cache, kept across frames.
+/// @param key Identify the element in the cache. It must be stable across
+///            frames, and unique within the cache.
+/// @param hash Identify the content of the element. It must change whenever
+///             the element would be laid out or drawn differently.
+/// @see LayoutCache
+/// @ingroup dom
+Decorator cached(LayoutCache& cache, std::string key, size_t hash) {
+  return [&cache, key = std::move(key), hash](Element child) {
+    return cached(std::move(child), cache, key, hash);
+  };
+}
+
+}  // namespace ftxui
@@ -0,0 +1,17 @@
+/// @module ftxui.dom.layout_cache
+/// @brief Module file for the LayoutCache class of the Dom module
+
+module;
+
+#include <ftxui/dom/layout_cache.hpp>
+
+export module ftxui.dom.layout_cache;
+
+/**
+ * @namespace ftxui
+ * @brief The FTXUI ftxui:: namespace
+ */
+export namespace ftxui {
+    using ftxui::LayoutCache;
+    using ftxui::cached;
+}
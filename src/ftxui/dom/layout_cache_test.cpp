@@ -0,0 +1,248 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <memory>   // for make_shared
+#include <string>   // for string
+#include <utility>  // for move
+
+#include "ftxui/dom/elements.hpp"  // for text, vbox, hbox, border, hyperlink
+#include "ftxui/dom/layout_cache.hpp"  // for LayoutCache, cached
+#include "ftxui/dom/node.hpp"          // for Node, Render
+#include "ftxui/dom/requirement.hpp"   // for Requirement
+#include "ftxui/screen/glyph.hpp"      // for Glyph
+#include "ftxui/screen/screen.hpp"     // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+struct Counters {
+  int requirement = 0;
+  int render = 0;
+};
+
+// A leaf counting how many times its layout is computed and it is drawn.
+class Counting : public Node {
+ public:
+  Counting(std::string content, Counters& counters)
+      : content_(std::move(content)), counters_(counters) {}
+
+  void ComputeRequirement() override {
+    counters_.requirement++;
+    requirement_.min_x = int(content_.size());
+    requirement_.min_y = 1;
+  }
+
+  void Render(Screen& screen) override {
+    counters_.render++;
+    int x = box_.x_min;
+    for (const char c : content_) {
+      if (x > box_.x_max) {
+        break;
+      }
+      screen.PixelAt(x++, box_.y_min).character = std::string(1, c);
+    }
+  }
+
+ private:
+  std::string content_;
+  Counters& counters_;
+};
+
+Element counting(std::string content, Counters& counters) {
+  return std::make_shared<Counting>(std::move(content), counters);
+}
+
+}  // namespace
+
+TEST(LayoutCacheTest, SameOutput) {
+  LayoutCache cache;
+  auto document = [&] {
+    return vbox({
+               text("title") | cached(cache, "title", 1),
+               hbox({
+                   text("left") | border | cached(cache, "left", 1),
+                   text("right") | bold | cached(cache, "right", 1),
+               }),
+           }) |
+           border;
+  };
+
+  Screen expected(20, 6);
+  Render(expected, vbox({
+                       text("title"),
+                       hbox({text("left") | border, text("right") | bold}),
+                   }) |
+                       border);
+
+  for (int i = 0; i < 3; ++i) {
+    Screen screen(20, 6);
+    Render(screen, document());
+    EXPECT_EQ(screen.ToString(), expected.ToString());
+  }
+  EXPECT_EQ(cache.size(), 3u);
+}
+
+TEST(LayoutCacheTest, HitSkipsLayoutAndRendering) {
+  LayoutCache cache;
+  Counters counters;
+  Screen screen(10, 2);
+
+  Render(screen, counting("abc", counters) | cached(cache, "a", 0));
+  EXPECT_EQ(counters.requirement, 1);
+  EXPECT_EQ(counters.render, 1);
+  EXPECT_EQ(screen.ToString(), "abc       \r\n          ");
+
+  for (int i = 0; i < 3; ++i) {
+    screen.Clear();
+    Render(screen, counting("abc", counters) | cached(cache, "a", 0));
+    EXPECT_EQ(screen.ToString(), "abc       \r\n          ");
+  }
+  EXPECT_EQ(counters.requirement, 1);
+  EXPECT_EQ(counters.render, 1);
+}
+
+TEST(LayoutCacheTest, HashChange) {
+  LayoutCache cache;
+  Counters counters;
+  Screen screen(10, 1);
+
+  Render(screen, counting("abc", counters) | cached(cache, "a", 0));
+  screen.Clear();
+  Render(screen, counting("defgh", counters) | cached(cache, "a", 1));
+  EXPECT_EQ(counters.requirement, 2);
+  EXPECT_EQ(counters.render, 2);
+  EXPECT_EQ(screen.ToString(), "defgh     ");
+  EXPECT_EQ(cache.size(), 1u);
+}
+
+TEST(LayoutCacheTest, BoxChange) {
+  LayoutCache cache;
+  Counters counters;
+  auto document = [&](int offset) {
+    return hbox({
+        text(std::string(offset, '.')),
+        counting("abc", counters) | cached(cache, "a", 0),
+    });
+  };
+
+  Screen screen(10, 1);
+  Render(screen, document(1));
+  EXPECT_EQ(screen.ToString(), ".abc      ");
+
+  screen.Clear();
+  Render(screen, document(3));
+  EXPECT_EQ(screen.ToString(), "...abc    ");
+  EXPECT_EQ(counters.requirement, 2);
+  EXPECT_EQ(counters.render, 2);
+
+  // The new box is reused.
+  screen.Clear();
+  Render(screen, document(3));
+  EXPECT_EQ(screen.ToString(), "...abc    ");
+  EXPECT_EQ(counters.render, 2);
+}
+
+TEST(LayoutCacheTest, ChangedBackground) {
+  LayoutCache cache;
+  Counters counters;
+  auto document = [&](Color c) {
+    return counting("abc", counters) | cached(cache, "a", 0) | color(c);
+  };
+
+  Screen screen(3, 1);
+  Render(screen, document(Color::Red));
+  screen.Clear();
+  Render(screen, document(Color::Red));
+  EXPECT_EQ(counters.render, 1);
+
+  // The color applied by the parent is drawn below the cached element.
+  screen.Clear();
+  Render(screen, document(Color::Blue));
+  EXPECT_EQ(counters.render, 2);
+  EXPECT_EQ(screen.PixelAt(0, 0).foreground_color, Color(Color::Blue));
+}
+
+TEST(LayoutCacheTest, HyperlinkAndAutomerge) {
+  LayoutCache cache;
+  auto document = [&] {
+    return vbox({
+        text("a") | border | hyperlink("https://a.com") | cached(cache, "a", 0),
+        text("b") | border | cached(cache, "b", 0),
+    });
+  };
+
+  Screen expected(3, 6);
+  Render(expected, vbox({
+                       text("a") | border | hyperlink("https://a.com"),
+                       text("b") | border,
+                   }));
+
+  Screen screen(3, 6);
+  Render(screen, document());
+
+  // A new screen uses different hyperlink ids.
+  Screen other(3, 6);
+  other.RegisterHyperlink("https://other.com");
+  Render(other, document());
+  EXPECT_EQ(other.ToString(), expected.ToString());
+  EXPECT_EQ(other.Hyperlink(other.PixelAt(1, 1).hyperlink), "https://a.com");
+}
+
+TEST(LayoutCacheTest, Clear) {
+  LayoutCache cache;
+  Counters counters;
+  Screen screen(3, 1);
+  Render(screen, counting("abc", counters) | cached(cache, "a", 0));
+  cache.Clear();
+  EXPECT_EQ(cache.size(), 0u);
+  Render(screen, counting("abc", counters) | cached(cache, "a", 0));
+  EXPECT_EQ(counters.render, 2);
+}
+
+TEST(LayoutCacheTest, EvictUnused) {
+  LayoutCache cache(2);
+  Screen screen(3, 2);
+  Render(screen, vbox({
+                     text("a") | cached(cache, "a", 0),
+                     text("b") | cached(cache, "b", 0),
+                 }));
+  EXPECT_EQ(cache.size(), 2u);
+
+  // "b" is kept for 2 frames without being used, then removed.
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(cache.size(), 2u);
+    Render(screen, text("a") | cached(cache, "a", 0));
+  }
+  EXPECT_EQ(cache.size(), 1u);
+
+  // Laying out an element outside of Render() doesn't start a frame.
+  Render(screen, vbox({
+                     text("a") | cached(cache, "a", 0),
+                     text("b") | cached(cache, "b", 0),
+                 }));
+  for (int i = 0; i < 3; ++i) {
+    Element element = text("a") | cached(cache, "a", 0);
+    Dimension::Fit(element);
+  }
+  EXPECT_EQ(cache.size(), 2u);
+}
+
+TEST(LayoutCacheTest, ReleaseInterned) {
+  // The cells holding interned graphemes aren't reused once released. A
+  // letter with 4 combining accents, too long to be stored inline.
+  const std::string accented = "a\u0301\u0302\u0303\u0304";
+  LayoutCache cache;
+  for (int i = 0; i < 2; ++i) {
+    Screen screen(4, 1);
+    Render(screen, text(accented) | cached(cache, "a", 0));
+    EXPECT_EQ(screen.ToString(), accented + "   ");
+    Glyph::ReleaseInterned();
+    Glyph::ReleaseInterned();
+  }
+}
+
+}  // namespace ftxui
+// NOLINTEND
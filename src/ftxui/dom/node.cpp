@@ -2,16 +2,72 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <ftxui/screen/box.hpp>  // for Box
+#include <atomic>                 // for atomic
+#include <cstdint>                // for uint32_t
 #include <string>
 #include <utility>  // for move
 
 #include <cstddef>
 #include "ftxui/dom/node.hpp"
+#include "ftxui/dom/node_layout.hpp"  // for Layout, CurrentRender
 #include "ftxui/dom/selection.hpp"  // for Selection
 #include "ftxui/screen/screen.hpp"  // for Screen
+#include "ftxui/util/autoreset.hpp"  // for AutoReset
 
 namespace ftxui {
 
+namespace {
+// The statistics of the element being drawn on this thread, if any.
+thread_local LayoutStats* g_stats = nullptr;  // NOLINT
+
+// The id of the rendering in progress on this thread, if any.
+thread_local uint32_t g_render = 0;  // NOLINT
+
+uint32_t NewRender() {
+  static std::atomic<uint32_t> last_render{0};
+  uint32_t render = ++last_render;
+  if (render == 0) {
+    render = ++last_render;
+  }
+  return render;
+}
+
+// Compute the layout of |node| inside |box|. The iterations are repeated
+// until every node is satisfied, laying out again only the subtrees where a
+// node requested it.
+void LayoutWithStats(Node* node, Box box, LayoutStats& stats) {
+  stats = LayoutStats();
+  Node::Status status;
+  node->CheckLayout(&status);
+  const int max_iterations = 20;
+  while (status.need_iteration && status.iteration < max_iterations) {
+    stats.passes++;
+    stats.recomputed_nodes += status.invalid_nodes;
+
+    // Step 1: Find what dimension this elements wants to be.
+    node->UpdateRequirement();
+
+    // Step 2: Assign a dimension to the element.
+    node->UpdateBox(box);
+
+    // Check if the element needs another iteration of the layout algorithm.
+    status.need_iteration = false;
+    status.invalid_nodes = 0;
+    status.iteration++;
+    node->CheckLayout(&status);
+  }
+}
+}  // namespace
+
+void Layout(Node* node, Box box) {
+  LayoutStats stats;
+  LayoutWithStats(node, box, stats);
+}
+
+uint32_t CurrentRender() {
+  return g_render;
+}
+
 Node::Node() = default;
 Node::Node(Elements children) : children_(std::move(children)) {}
 Node::~Node() = default;
@@ -22,7 +78,7 @@ void Node::ComputeRequirement() {
     return;
   }
   for (auto& child : children_) {
-    child->ComputeRequirement();
+    child->UpdateRequirement();
   }
 
   // By default, the requirement is the one of the first child.
@@ -58,17 +114,64 @@ void Node::Select(Selection& selection) {
 /// @brief Display an element on a ftxui::Screen.
 void Node::Render(Screen& screen) {
   for (auto& child : children_) {
-    child->Render(screen);
+    child->RenderIfVisible(screen);
   }
 }
 
+/// @brief Display an element on a ftxui::Screen, unless it is outside of the
+/// stencil. Its children are skipped, without being visited.
+void Node::RenderIfVisible(Screen& screen) {
+  if (Box::Intersection(box_, screen.stencil).IsEmpty()) {
+    if (g_stats) {
+      g_stats->culled_nodes++;
+    }
+    return;
+  }
+  Render(screen);
+}
+
 void Node::Check(Status* status) {
   for (auto& child : children_) {
-    child->Check(status);
+    child->CheckLayout(status);
   }
   status->need_iteration |= (status->iteration == 0);
 }
 
+/// @brief Check whether this element must be laid out again in the next
+/// iteration. It must be, when one of the node of its subtree requests it.
+void Node::CheckLayout(Status* status) {
+  const bool need_iteration = status->need_iteration;
+  status->need_iteration = false;
+  Check(status);
+
+  const bool valid = status->iteration != 0 && !status->need_iteration;
+  requirement_valid_ = valid;
+  box_valid_ = valid;
+  status->invalid_nodes += valid ? 0 : 1;
+  status->need_iteration |= need_iteration;
+}
+
+/// @brief Compute the requirement, unless the previous one is still valid.
+void Node::UpdateRequirement() {
+  if (requirement_valid_) {
+    requirement_valid_ = false;
+    return;
+  }
+  ComputeRequirement();
+}
+
+/// @brief Assign a box, unless the same one was assigned in the previous
+/// iteration and is still valid.
+void Node::UpdateBox(Box box) {
+  const bool valid = box_valid_ && box == layout_box_;
+  box_valid_ = false;
+  if (valid) {
+    return;
+  }
+  layout_box_ = box;
+  SetBox(box);
+}
+
 std::string Node::GetSelectedContent(Selection& selection) {
   std::string content;
 
@@ -93,28 +196,28 @@ void Render(Screen& screen, Node* node) {
   Render(screen, node, selection);
 }
 
+/// @brief Display an element on a ftxui::Screen.
+/// @ingroup dom
 void Render(Screen& screen, Node* node, Selection& selection) {
+  LayoutStats stats;
+  Render(screen, node, selection, stats);
+}
+
+/// @brief Display an element on a ftxui::Screen, and report how its layout
+/// was computed.
+/// @ingroup dom
+void Render(Screen& screen,
+            Node* node,
+            Selection& selection,
+            LayoutStats& stats) {
   Box box;
   box.x_min = 0;
   box.y_min = 0;
   box.x_max = screen.dimx() - 1;
   box.y_max = screen.dimy() - 1;
 
-  Node::Status status;
-  node->Check(&status);
-  const int max_iterations = 20;
-  while (status.need_iteration && status.iteration < max_iterations) {
-    // Step 1: Find what dimension this elements wants to be.
-    node->ComputeRequirement();
-
-    // Step 2: Assign a dimension to the element.
-    node->SetBox(box);
-
-    // Check if the element needs another iteration of the layout algorithm.
-    status.need_iteration = false;
-    status.iteration++;
-    node->Check(&status);
-  }
+  const AutoReset<uint32_t> current_render(&g_render, NewRender());
+  LayoutWithStats(node, box, stats);
 
   // Step 3: Selection
   if (!selection.IsEmpty()) {
@@ -159,7 +262,10 @@ void Render(Screen& screen, Node* node, Selection& selection) {
 
   // Step 4: Draw the element.
   screen.stencil = box;
-  node->Render(screen);
+  {
+    const AutoReset<LayoutStats*> current_stats(&g_stats, &stats);
+    node->Render(screen);
+  }
 
   // Step 5: Apply shaders
   screen.ApplyShader();
@@ -174,21 +280,8 @@ std::string GetNodeSelectedContent(Screen& screen,
   box.x_max = screen.dimx() - 1;
   box.y_max = screen.dimy() - 1;
 
-  Node::Status status;
-  node->Check(&status);
-  const int max_iterations = 20;
-  while (status.need_iteration && status.iteration < max_iterations) {
-    // Step 1: Find what dimension this elements wants to be.
-    node->ComputeRequirement();
-
-    // Step 2: Assign a dimension to the element.
-    node->SetBox(box);
-
-    // Check if the element needs another iteration of the layout algorithm.
-    status.need_iteration = false;
-    status.iteration++;
-    node->Check(&status);
-  }
+  const AutoReset<uint32_t> current_render(&g_render, NewRender());
+  Layout(node, box);
 
   // Step 3: Selection
   node->Select(selection);
@@ -17,6 +17,7 @@ export namespace ftxui {
 
     using ftxui::Element;
     using ftxui::Elements;
+    using ftxui::LayoutStats;
 
     using ftxui::Render;
     using ftxui::GetNodeSelectedContent;
@@ -0,0 +1,25 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_DOM_NODE_LAYOUT_HPP
+#define FTXUI_DOM_NODE_LAYOUT_HPP
+
+#include <cstdint>  // for uint32_t
+
+#include "ftxui/dom/node.hpp"    // for Node
+#include "ftxui/screen/box.hpp"  // for Box
+
+namespace ftxui {
+
+// Compute the layout of |node| inside |box|. The iterations are repeated
+// until every node is satisfied. Used by the elements laying out a child on
+// their own, outside of the layout of the whole tree.
+void Layout(Node* node, Box box);
+
+// Identify the call to Render() or GetNodeSelectedContent() in progress on
+// this thread. Each call gets a different id. It is 0 outside of them.
+uint32_t CurrentRender();
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_NODE_LAYOUT_HPP
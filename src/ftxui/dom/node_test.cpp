@@ -0,0 +1,127 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <memory>  // for make_shared
+#include <string>  // for to_string
+#include <utility>  // for move
+
+#include "ftxui/dom/elements.hpp"   // for text, hflow, vbox, yframe, reflect
+#include "ftxui/dom/node.hpp"       // for Node, Render, LayoutStats
+#include "ftxui/dom/selection.hpp"  // for Selection
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+// A leaf counting how many times its layout is computed.
+class Counting : public Node {
+ public:
+  explicit Counting(int& count) : count_(count) {}
+
+  void ComputeRequirement() override {
+    count_++;
+    requirement_.min_x = 1;
+    requirement_.min_y = 1;
+  }
+
+ private:
+  int& count_;
+};
+
+}  // namespace
+
+TEST(NodeTest, SingleLayoutPass) {
+  auto element = vbox({
+      text("a"),
+      hbox({text("b"), text("c")}),
+  });
+  Screen screen(5, 2);
+  Selection selection;
+  LayoutStats stats;
+  Render(screen, element.get(), selection, stats);
+  EXPECT_EQ(stats.passes, 1);
+  EXPECT_EQ(stats.recomputed_nodes, 5);
+  EXPECT_EQ(screen.ToString(), "a    \r\nbc   ");
+}
+
+TEST(NodeTest, OnlyTheRequestingSubtreeIsLaidOutAgain) {
+  int count = 0;
+  auto element = vbox({
+      std::make_shared<Counting>(count),
+      text("title") | border,
+      hbox({
+          hflow({text("aaa"), text("bbb"), text("ccc")}),
+      }),
+  });
+  Screen screen(7, 7);
+  Selection selection;
+  LayoutStats stats;
+  Render(screen, element.get(), selection, stats);
+
+  // The hflow asks for another iteration, once it knows its width changes its
+  // requirement. Only it and its parents are computed again.
+  EXPECT_EQ(stats.passes, 2);
+  EXPECT_EQ(stats.recomputed_nodes, 9 + 3);
+  EXPECT_EQ(count, 1);
+  EXPECT_EQ(screen.ToString(),
+            "       \r\n"
+            "╭─────╮\r\n"
+            "│title│\r\n"
+            "╰─────╯\r\n"
+            "aaabbb \r\n"
+            "ccc    \r\n"
+            "       ");
+}
+
+TEST(NodeTest, LayoutIsComputedAgainForEachRender) {
+  int count = 0;
+  auto element = hbox({std::make_shared<Counting>(count)});
+  Screen screen(2, 1);
+  Render(screen, element);
+  Render(screen, element);
+  EXPECT_EQ(count, 2);
+}
+
+TEST(NodeTest, NodesOutsideOfTheStencilAreCulled) {
+  Elements rows;
+  for (int i = 0; i < 100; ++i) {
+    rows.push_back(text(std::to_string(i)));
+  }
+  auto element = vbox(std::move(rows)) | focusPosition(0, 50) | yframe;
+
+  Screen screen(3, 3);
+  Selection selection;
+  LayoutStats stats;
+  Render(screen, element.get(), selection, stats);
+  EXPECT_EQ(screen.ToString(),
+            "49 \r\n"
+            "50 \r\n"
+            "51 ");
+  EXPECT_EQ(stats.culled_nodes, 97);
+}
+
+TEST(NodeTest, CulledReflectIsEmpty) {
+  Box visible;
+  Box hidden;
+  auto element = vbox({
+                     text("a") | reflect(visible),
+                     text("b"),
+                     text("c") | reflect(hidden),
+                 }) |
+                 yframe;
+
+  Screen screen(1, 2);
+  Render(screen, element);
+  EXPECT_EQ(visible.x_min, 0);
+  EXPECT_EQ(visible.x_max, 0);
+  EXPECT_EQ(visible.y_min, 0);
+  EXPECT_EQ(visible.y_max, 0);
+  EXPECT_TRUE(hidden.IsEmpty());
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -1,95 +1,387 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <functional>  // for function
-#include <sstream>     // for basic_istream, stringstream
-#include <string>      // for string, allocator, getline
-#include <utility>     // for move
+#include <algorithm>      // for max, min
+#include <cstddef>        // for size_t
+#include <cstdint>        // for uint32_t
+#include <string>         // for string
+#include <string_view>    // for string_view
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for move
+#include <vector>         // for vector
 
-#include "ftxui/dom/elements.hpp"  // for flexbox, Element, text, Elements, operator|, xflex, paragraph, paragraphAlignCenter, paragraphAlignJustify, paragraphAlignLeft, paragraphAlignRight
-#include "ftxui/dom/flexbox_config.hpp"  // for FlexboxConfig, FlexboxConfig::JustifyContent, FlexboxConfig::JustifyContent::Center, FlexboxConfig::JustifyContent::FlexEnd, FlexboxConfig::JustifyContent::SpaceBetween
+#include "ftxui/dom/box_helper.hpp"     // for Element, Compute
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
+#include "ftxui/dom/elements.hpp"  // for Element, paragraph, paragraphAlignCenter, paragraphAlignJustify, paragraphAlignLeft, paragraphAlignRight
+#include "ftxui/dom/node.hpp"               // for Node, Node::Status
+#include "ftxui/dom/requirement.hpp"        // for Requirement
+#include "ftxui/dom/selection.hpp"          // for Selection
+#include "ftxui/screen/box.hpp"             // for Box
+#include "ftxui/screen/screen.hpp"          // for Screen
+#include "ftxui/screen/string_internal.hpp"  // for Utf8ToGlyphEnds
 
 namespace ftxui {
 
 namespace {
-Elements Split(const std::string& the_text) {
-  Elements output;
-  std::stringstream ss(the_text);
-  std::string word;
-  while (std::getline(ss, word, ' ')) {
-    output.push_back(text(word));
+
+enum class Align {
+  Left,
+  Right,
+  Center,
+  Justify,
+};
+
+// A paragraph, broken into rows for the width it is given. The words are
+// placed like a flexbox of text elements with a gap of 1 would place them.
+class Paragraph : public Node {
+ public:
+  Paragraph(std::string text, Align align)
+      : bytes_(std::move(text)), align_(align) {
+    ends_ = Utf8ToGlyphEnds(bytes_);
+    Split();
   }
-  return output;
-}
 
-Element Split(const std::string& paragraph,
-              const std::function<Element(std::string)>& f) {
-  Elements output;
-  std::stringstream ss(paragraph);
-  std::string line;
-  while (std::getline(ss, line, '\n')) {
-    output.push_back(f(line));
+  void Check(Status* status) override {
+    if (status->iteration == 0) {
+      asked_ = 6000;  // NOLINT
+      need_iteration_ = true;
+    }
+    status->need_iteration |= need_iteration_;
   }
-  return vbox(std::move(output));
-}
+
+  void ComputeRequirement() override {
+    const Layout& layout = LayoutFor(asked_);
+    requirement_ = Requirement{};
+    requirement_.min_x = layout.min_x;
+    requirement_.min_y = int(layout.rows.size());
+    selected_.clear();
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    const int asked_previous = asked_;
+    asked_ = std::min(asked_, box.x_max - box.x_min + 1);
+    need_iteration_ = (asked_ != asked_previous);
+  }
+
+  void Select(Selection& selection) override {
+    const Box box = Box::Intersection(selection.GetBox(), box_);
+    if (box.IsEmpty()) {
+      return;
+    }
+
+    const Layout& layout = LayoutFor(box_.x_max - box_.x_min + 1);
+    for (int y = box.y_min; y <= box.y_max; ++y) {
+      const size_t index = size_t(y - box_.y_min);
+      if (index >= layout.rows.size()) {
+        break;
+      }
+
+      Box row_box = box_;
+      row_box.y_min = y;
+      row_box.y_max = y;
+      const Box range = selection.SaturateHorizontal(row_box).GetBox();
+
+      // The selected part of every word, separated by spaces.
+      std::string part;
+      const Row& row = layout.rows[index];
+      Place(row, box_.x_max - box_.x_min + 1, /*requirement=*/false);
+      for (size_t i = 0; i < blocks_.size(); ++i) {
+        const Word& word = words_[row.begin + i];
+        const int x = box_.x_min + blocks_[i].x;
+        const int dim = std::min(word.Width(), blocks_[i].dim);
+        std::string word_part;
+        for (int k = std::max(0, range.x_min - x);
+             k < std::min(dim, range.x_max - x + 1); ++k) {
+          word_part += Cell(word.begin + uint32_t(k));
+        }
+        if (word_part.empty()) {
+          continue;
+        }
+        if (!part.empty()) {
+          part += ' ';
+        }
+        part += word_part;
+      }
+
+      if (!part.empty()) {
+        selected_.push_back({y, range.x_min, range.x_max});
+        selection.AddPart(part, y, range.x_min, range.x_max);
+      }
+    }
+  }
+
+  void Render(Screen& screen) override {
+    const Box box = Box::Intersection(screen.stencil, box_);
+    if (box.IsEmpty()) {
+      return;
+    }
+
+    const Layout& layout = LayoutFor(box_.x_max - box_.x_min + 1);
+    auto selected = selected_.begin();
+    for (int y = box.y_min; y <= box.y_max; ++y) {
+      const size_t index = size_t(y - box_.y_min);
+      if (index >= layout.rows.size()) {
+        break;
+      }
+
+      while (selected != selected_.end() && selected->y < y) {
+        ++selected;
+      }
+      const bool has_selection = selected != selected_.end() &&  //
+                                 selected->y == y;
+
+      const Row& row = layout.rows[index];
+      Place(row, box_.x_max - box_.x_min + 1, /*requirement=*/false);
+      for (size_t i = 0; i < blocks_.size(); ++i) {
+        const Word& word = words_[row.begin + i];
+        const int x_min = box_.x_min + blocks_[i].x;
+        const int x_max = std::min(
+            box_.x_max, x_min + std::min(word.Width(), blocks_[i].dim) - 1);
+        for (int x = std::max(x_min, box_.x_min); x <= x_max; ++x) {
+          Pixel& pixel = screen.PixelAt(x, y);
+          pixel.character = Cell(word.begin + uint32_t(x - x_min));
+          if (has_selection && selected->start <= x && x <= selected->end) {
+            screen.GetSelectionStyle()(pixel);
+          }
+        }
+      }
+    }
+  }
+
+ private:
+  // A word, made of the cells [begin, end). The filler ends the lines of a
+  // justified paragraph. It grows to fill the last row.
+  struct Word {
+    uint32_t begin;
+    uint32_t end;
+    bool filler = false;
+
+    int Width() const { return int(end - begin); }
+  };
+
+  // The words [begin, end) drawn on the same row.
+  struct Row {
+    uint32_t begin;
+    uint32_t end;
+  };
+
+  struct Layout {
+    std::vector<Row> rows;
+    int min_x = 0;
+  };
+
+  // The position of a word in its row.
+  struct Block {
+    int x;
+    int dim;
+  };
+
+  struct Selected {
+    int y;
+    int start;
+    int end;
+  };
+
+  std::string_view Cell(uint32_t i) const {
+    const uint32_t begin = i == 0 ? 0 : ends_[i - 1];
+    return {bytes_.data() + begin, size_t(ends_[i] - begin)};
+  }
+
+  // Split the cells into words, separated by spaces, and into lines,
+  // separated by new lines. Like std::getline, the last word of a line and
+  // the last line of the paragraph are ignored when empty.
+  void Split() {
+    uint32_t word_begin = 0;
+    uint32_t line_begin = 0;
+    auto add_word = [&](uint32_t end, bool last) {
+      if (!last || end != word_begin) {
+        words_.push_back({word_begin, end});
+      }
+      word_begin = end + 1;
+    };
+    auto add_line = [&](uint32_t end) {
+      if (align_ == Align::Justify) {
+        words_.push_back({end, end, true});
+      }
+      line_ends_.push_back(uint32_t(words_.size()));
+      line_begin = end + 1;
+    };
+
+    const auto size = uint32_t(ends_.size());
+    for (uint32_t i = 0; i < size; ++i) {
+      const uint32_t begin = i == 0 ? 0 : ends_[i - 1];
+      if (begin == ends_[i]) {
+        continue;
+      }
+      if (bytes_[begin] == ' ') {
+        add_word(i, false);
+      } else if (bytes_[begin] == '\n') {
+        add_word(i, true);
+        add_line(i);
+      }
+    }
+    if (line_begin != size) {
+      add_word(size, true);
+      add_line(size);
+    }
+  }
+
+  // Break the lines into rows fitting |width|. The result is cached for every
+  // width the paragraph is laid out with.
+  const Layout& LayoutFor(int width) {
+    auto it = layouts_.find(width);
+    if (it != layouts_.end()) {
+      return it->second;
+    }
+    if (layouts_.size() >= 8) {  // NOLINT
+      layouts_.clear();
+    }
+
+    Layout& layout = layouts_[width];
+    uint32_t begin = 0;
+    for (const uint32_t end : line_ends_) {
+      Row row = {begin, begin};
+      int x = 0;
+      for (uint32_t i = begin; i < end; ++i) {
+        const int word_width = words_[i].Width();
+        if (x + word_width > width) {
+          x = 0;
+          if (row.begin != row.end) {
+            layout.rows.push_back(row);
+          }
+          row = {i, i};
+        }
+        row.end = i + 1;
+        x += word_width + 1;
+      }
+      if (row.begin != row.end) {
+        layout.rows.push_back(row);
+      }
+      begin = end;
+    }
+
+    for (const Row& row : layout.rows) {
+      Place(row, width, /*requirement=*/true);
+      const Block& last = blocks_.back();
+      layout.min_x = std::max(layout.min_x, last.x + last.dim);
+    }
+    return layout;
+  }
+
+  // Compute the position of the words of |row| into |blocks_|. The
+  // requirement is computed without the alignment.
+  void Place(const Row& row, int width, bool requirement) {
+    elements_.clear();
+    for (uint32_t i = row.begin; i < row.end; ++i) {
+      box_helper::Element element;
+      element.min_size = words_[i].Width();
+      if (words_[i].filler && !requirement) {
+        element.flex_grow = 1;
+        element.flex_shrink = 1;
+      }
+      elements_.push_back(element);
+    }
+    box_helper::Compute(&elements_, width - (int(elements_.size()) - 1));
+
+    blocks_.clear();
+    int x = 0;
+    for (const box_helper::Element& element : elements_) {
+      blocks_.push_back({x, element.size});
+      x += element.size + 1;
+    }
+    if (requirement) {
+      return;
+    }
+
+    int remaining_space = width - blocks_.back().x - blocks_.back().dim;
+    switch (align_) {
+      case Align::Left:
+        break;
+
+      case Align::Right: {
+        for (Block& block : blocks_) {
+          block.x += remaining_space;
+        }
+        break;
+      }
+
+      case Align::Center: {
+        for (Block& block : blocks_) {
+          block.x += remaining_space / 2;
+        }
+        break;
+      }
+
+      case Align::Justify: {
+        for (int i = int(blocks_.size()) - 1; i >= 1; --i) {
+          blocks_[size_t(i)].x += remaining_space;
+          remaining_space = remaining_space * (i - 1) / i;
+        }
+        break;
+      }
+    }
+  }
+
+  std::string bytes_;
+  std::vector<uint32_t> ends_;
+  const Align align_;
+
+  std::vector<Word> words_;
+  std::vector<uint32_t> line_ends_;
+  std::unordered_map<int, Layout> layouts_;
+
+  int asked_ = 6000;  // NOLINT
+  bool need_iteration_ = true;
+  std::vector<Selected> selected_;
+
+  // Reused by Place().
+  std::vector<box_helper::Element> elements_;
+  std::vector<Block> blocks_;
+};
 
 }  // namespace
 
 /// @brief Return an element drawing the paragraph on multiple lines.
 /// @ingroup dom
-/// @see flexbox.
+/// @see paragraphAlignLeft.
 Element paragraph(const std::string& the_text) {
   return paragraphAlignLeft(the_text);
 }
 
 /// @brief Return an element drawing the paragraph on multiple lines, aligned on
 /// the left.
+///
+/// The words are separated by spaces, and wrapped to fit the width. The
+/// lines are broken once per width the paragraph is given.
 /// @ingroup dom
-/// @see flexbox.
 Element paragraphAlignLeft(const std::string& the_text) {
-  return Split(the_text, [](const std::string& line) {
-    static const auto config = FlexboxConfig().SetGap(1, 0);
-    return flexbox(Split(line), config);
-  });
+  return MakeElement<Paragraph>(the_text, Align::Left);
 };
 
 /// @brief Return an element drawing the paragraph on multiple lines, aligned on
 /// the right.
 /// @ingroup dom
-/// @see flexbox.
+/// @see paragraphAlignLeft.
 Element paragraphAlignRight(const std::string& the_text) {
-  return Split(the_text, [](const std::string& line) {
-    static const auto config = FlexboxConfig().SetGap(1, 0).Set(
-        FlexboxConfig::JustifyContent::FlexEnd);
-    return flexbox(Split(line), config);
-  });
+  return MakeElement<Paragraph>(the_text, Align::Right);
 }
 
 /// @brief Return an element drawing the paragraph on multiple lines, aligned on
 /// the center.
 /// @ingroup dom
-/// @see flexbox.
+/// @see paragraphAlignLeft.
 Element paragraphAlignCenter(const std::string& the_text) {
-  return Split(the_text, [](const std::string& line) {
-    static const auto config =
-        FlexboxConfig().SetGap(1, 0).Set(FlexboxConfig::JustifyContent::Center);
-    return flexbox(Split(line), config);
-  });
+  return MakeElement<Paragraph>(the_text, Align::Center);
 }
 
 /// @brief Return an element drawing the paragraph on multiple lines, aligned
 /// using a justified alignment.
 /// the center.
 /// @ingroup dom
-/// @see flexbox.
+/// @see paragraphAlignLeft.
 Element paragraphAlignJustify(const std::string& the_text) {
-  return Split(the_text, [](const std::string& line) {
-    static const auto config = FlexboxConfig().SetGap(1, 0).Set(
-        FlexboxConfig::JustifyContent::SpaceBetween);
-    Elements words = Split(line);
-    words.push_back(text("") | xflex);
-    return flexbox(std::move(words), config);
-  });
+  return MakeElement<Paragraph>(the_text, Align::Justify);
 }
 
 }  // namespace ftxui
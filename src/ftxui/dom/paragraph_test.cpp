@@ -0,0 +1,129 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for string
+
+#include "ftxui/dom/elements.hpp"   // for paragraph, yframe, focusPosition
+#include "ftxui/dom/node.hpp"       // for Render, LayoutStats
+#include "ftxui/dom/selection.hpp"  // for Selection
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+const std::string kText = "the quick brown fox jumps over the lazy dog";
+}  // namespace
+
+TEST(ParagraphTest, AlignLeft) {
+  auto element = paragraphAlignLeft(kText);
+  Screen screen(10, 5);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "the quick \r\n"
+            "brown fox \r\n"
+            "jumps over\r\n"
+            "the lazy  \r\n"
+            "dog       ");
+  EXPECT_EQ(element->requirement().min_x, 10);
+  EXPECT_EQ(element->requirement().min_y, 5);
+}
+
+TEST(ParagraphTest, AlignRight) {
+  auto element = paragraphAlignRight(kText);
+  Screen screen(10, 5);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            " the quick\r\n"
+            " brown fox\r\n"
+            "jumps over\r\n"
+            "  the lazy\r\n"
+            "       dog");
+}
+
+TEST(ParagraphTest, AlignCenter) {
+  auto element = paragraphAlignCenter(kText);
+  Screen screen(10, 5);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "the quick \r\n"
+            "brown fox \r\n"
+            "jumps over\r\n"
+            " the lazy \r\n"
+            "   dog    ");
+}
+
+TEST(ParagraphTest, AlignJustify) {
+  auto element = paragraphAlignJustify(kText);
+  Screen screen(11, 5);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "the   quick\r\n"
+            "brown   fox\r\n"
+            "jumps  over\r\n"
+            "the    lazy\r\n"
+            "dog        ");
+}
+
+TEST(ParagraphTest, Lines) {
+  auto element = paragraph("a b\n\nc  d\n");
+  Screen screen(4, 3);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "a b \r\n"
+            "c  d\r\n"
+            "    ");
+  EXPECT_EQ(element->requirement().min_y, 2);
+}
+
+TEST(ParagraphTest, LongWord) {
+  auto element = paragraph("aaaaaaaa bb");
+  Screen screen(5, 3);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "aaaaa\r\n"
+            "bb   \r\n"
+            "     ");
+}
+
+TEST(ParagraphTest, Fullwidth) {
+  auto element = paragraph("测试 测试 ab");
+  Screen screen(5, 3);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "测试 \r\n"
+            "测试 \r\n"
+            "ab   ");
+}
+
+TEST(ParagraphTest, Selection) {
+  auto element = paragraph(kText);
+  Screen screen(10, 5);
+  Selection selection(6, 0, 2, 1);
+  Render(screen, element.get(), selection);
+  EXPECT_EQ(selection.GetParts(), "ick\nbro");
+}
+
+TEST(ParagraphTest, SingleNode) {
+  std::string content;
+  for (int i = 10000; i < 20000; ++i) {
+    content += "word" + std::to_string(i) + " ";
+  }
+  auto element = paragraph(content) | focusPosition(0, 2500) | yframe;
+  Screen screen(20, 3);
+  Selection selection;
+  LayoutStats stats;
+  Render(screen, element.get(), selection, stats);
+
+  // Two words per row. The paragraph, the frame and the focus are laid out
+  // twice.
+  EXPECT_EQ(stats.recomputed_nodes, 3 + 3);
+  EXPECT_EQ(screen.ToString(),
+            "word14998 word14999 \r\n"
+            "word15000 word15001 \r\n"
+            "word15002 word15003 ");
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -4,6 +4,7 @@
 #include <memory>   // for make_shared, __shared_ptr_access
 #include <utility>  // for move
 
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
 #include "ftxui/dom/elements.hpp"     // for Element, unpack, Decorator, reflect
 #include "ftxui/dom/node.hpp"         // for Node, Elements
 #include "ftxui/dom/requirement.hpp"  // for Requirement
@@ -25,13 +26,15 @@ class Reflect : public Node {
   }
 
   void SetBox(Box box) final {
-    reflected_box_ = box;
+    // The element may not be drawn, when outside of the stencil. It is then
+    // invisible.
+    reflected_box_ = Box{0, -1, 0, -1};
     Node::SetBox(box);
-    children_[0]->SetBox(box);
+    children_[0]->UpdateBox(box);
   }
 
   void Render(Screen& screen) final {
-    reflected_box_ = Box::Intersection(screen.stencil, reflected_box_);
+    reflected_box_ = Box::Intersection(screen.stencil, box_);
     Node::Render(screen);
   }
 
@@ -42,7 +45,7 @@ class Reflect : public Node {
 
 Decorator reflect(Box& box) {
   return [&](Element child) -> Element {
-    return std::make_shared<Reflect>(std::move(child), box);
+    return MakeElement<Reflect>(std::move(child), box);
   };
 }
 
@@ -6,6 +6,7 @@
 #include <string>     // for string
 #include <utility>    // for move
 
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
 #include "ftxui/dom/elements.hpp"  // for Element, vscroll_indicator, hscroll_indicator
 #include "ftxui/dom/node.hpp"            // for Node, Elements
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
@@ -31,7 +32,7 @@ Element vscroll_indicator(Element child) {
     void SetBox(Box box) override {
       box_ = box;
       box.x_max--;
-      children_[0]->SetBox(box);
+      children_[0]->UpdateBox(box);
     }
 
     void Render(Screen& screen) final {
@@ -67,7 +68,7 @@ Element vscroll_indicator(Element child) {
       }
     }
   };
-  return std::make_shared<Impl>(std::move(child));
+  return MakeElement<Impl>(std::move(child));
 }
 
 /// @brief Display a horizontal scrollbar at the bottom.
@@ -86,7 +87,7 @@ Element hscroll_indicator(Element child) {
     void SetBox(Box box) override {
       box_ = box;
       box.y_max--;
-      children_[0]->SetBox(box);
+      children_[0]->UpdateBox(box);
     }
 
     void Render(Screen& screen) final {
@@ -123,7 +124,7 @@ Element hscroll_indicator(Element child) {
       }
     }
   };
-  return std::make_shared<Impl>(std::move(child));
+  return MakeElement<Impl>(std::move(child));
 }
 
 }  // namespace ftxui
@@ -0,0 +1,104 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <memory>    // for make_shared
+#include <optional>  // for optional
+#include <utility>   // for move
+
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
+#include "ftxui/dom/style_decorator.hpp"
+#include "ftxui/screen/color.hpp"   // for Color
+#include "ftxui/screen/pixel.hpp"   // for PixelStyle
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+namespace {
+
+bool IsEmpty(const PixelStyle& style) {
+  return !style.blink && !style.bold && !style.dim && !style.italic &&
+         !style.underlined && !style.underlined_double &&
+         !style.strikethrough && !style.automerge && !style.inverted &&
+         !style.background_color && !style.foreground_color;
+}
+
+// Merge the color |second| applied after |first| into |first|.
+bool MergeColor(std::optional<Color>& first,
+                const std::optional<Color>& second) {
+  if (!second) {
+    return true;
+  }
+  // Blending twice can't be expressed as a single color.
+  if (first && !second->IsOpaque()) {
+    return false;
+  }
+  first = second;
+  return true;
+}
+
+// Merge the style |second| applied after |first| into |first|. Returns false
+// when the result can't be expressed as a single style.
+bool Merge(PixelStyle& first, const PixelStyle& second) {
+  if (!MergeColor(first.background_color, second.background_color) ||
+      !MergeColor(first.foreground_color, second.foreground_color)) {
+    return false;
+  }
+  first.blink |= second.blink;
+  first.bold |= second.bold;
+  first.dim |= second.dim;
+  first.italic |= second.italic;
+  first.underlined |= second.underlined;
+  first.underlined_double |= second.underlined_double;
+  first.strikethrough |= second.strikethrough;
+  first.automerge |= second.automerge;
+  first.inverted ^= second.inverted;
+  return true;
+}
+
+}  // namespace
+
+StyleDecorator::StyleDecorator(Element child,
+                               const PixelStyle& before,
+                               const PixelStyle& after)
+    : NodeDecorator(std::move(child)), before_(before), after_(after) {}
+
+// static
+Element StyleDecorator::Make(Element child,
+                             const PixelStyle& before,
+                             const PixelStyle& after) {
+  // NOLINTNEXTLINE
+  auto* inner = dynamic_cast<StyleDecorator*>(child.get());
+  if (!inner) {
+    return MakeElement<StyleDecorator>(std::move(child), before, after);
+  }
+
+  // Before rendering, the outer style is applied first. After rendering, the
+  // inner style is applied first.
+  PixelStyle merged_before = before;
+  PixelStyle merged_after = inner->after_;
+  if (!Merge(merged_before, inner->before_) || !Merge(merged_after, after)) {
+    return MakeElement<StyleDecorator>(std::move(child), before, after);
+  }
+
+  // Nobody else can observe the inner node. It can be updated in place.
+  if (child.use_count() == 1) {
+    inner->before_ = merged_before;
+    inner->after_ = merged_after;
+    return child;
+  }
+
+  return MakeElement<StyleDecorator>(inner->children_[0], merged_before,
+                                          merged_after);
+}
+
+void StyleDecorator::Render(Screen& screen) {
+  if (!IsEmpty(before_)) {
+    screen.ApplyStyle(box_, before_);
+  }
+  Node::Render(screen);
+  if (!IsEmpty(after_)) {
+    screen.ApplyStyle(box_, after_);
+  }
+}
+
+}  // namespace ftxui
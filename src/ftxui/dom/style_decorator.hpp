@@ -0,0 +1,38 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_DOM_STYLE_DECORATOR_H_
+#define FTXUI_DOM_STYLE_DECORATOR_H_
+
+#include "ftxui/dom/elements.hpp"        // for Element
+#include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
+#include "ftxui/screen/pixel.hpp"        // for PixelStyle
+
+namespace ftxui {
+class Screen;
+
+// A NodeDecorator applying a style to its box, before and after rendering its
+// child.
+class StyleDecorator : public NodeDecorator {
+ public:
+  StyleDecorator(Element child,
+                 const PixelStyle& before,
+                 const PixelStyle& after);
+
+  // Decorate |child| with a style applied before and after rendering it.
+  // When |child| is itself a StyleDecorator, the two are fused into a single
+  // node, applying a single combined style.
+  static Element Make(Element child,
+                      const PixelStyle& before,
+                      const PixelStyle& after);
+
+  void Render(Screen& screen) override;
+
+ private:
+  PixelStyle before_;
+  PixelStyle after_;
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_DOM_STYLE_DECORATOR_H_ */
@@ -0,0 +1,72 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>   // for allocator, string
+#include <utility>  // for move
+
+#include "ftxui/dom/elements.hpp"  // for operator|, text, bold, Element, color
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/color.hpp"   // for Color
+#include "ftxui/screen/screen.hpp"  // for Screen, Pixel
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(StyleDecoratorTest, Fused) {
+  Element element = text("text") | bold;
+  const Node* node = element.get();
+  element = std::move(element) | dim | color(Color::Red) | bgcolor(Color::Blue);
+  EXPECT_EQ(element.get(), node);
+
+  Screen screen(5, 1);
+  Render(screen, element);
+  for (int x = 0; x < 5; ++x) {
+    const Pixel& pixel = screen.PixelAt(x, 0);
+    EXPECT_TRUE(pixel.bold);
+    EXPECT_TRUE(pixel.dim);
+    EXPECT_EQ(pixel.foreground_color, Color(Color::Red));
+    EXPECT_EQ(pixel.background_color, Color(Color::Blue));
+  }
+}
+
+TEST(StyleDecoratorTest, SharedChildIsNotModified) {
+  Element shared = text("text") | bold;
+  Element element = shared | dim;
+  EXPECT_NE(element.get(), shared.get());
+
+  Screen screen(4, 1);
+  Render(screen, shared);
+  EXPECT_TRUE(screen.PixelAt(0, 0).bold);
+  EXPECT_FALSE(screen.PixelAt(0, 0).dim);
+
+  screen.Clear();
+  Render(screen, element);
+  EXPECT_TRUE(screen.PixelAt(0, 0).bold);
+  EXPECT_TRUE(screen.PixelAt(0, 0).dim);
+}
+
+TEST(StyleDecoratorTest, InnerColorWins) {
+  Screen screen(4, 1);
+  Render(screen, text("text") | color(Color::Red) | color(Color::Blue));
+  EXPECT_EQ(screen.PixelAt(0, 0).foreground_color, Color(Color::Red));
+}
+
+TEST(StyleDecoratorTest, InvertedTwice) {
+  Screen screen(4, 1);
+  Render(screen, text("text") | inverted | inverted);
+  EXPECT_FALSE(screen.PixelAt(0, 0).inverted);
+}
+
+TEST(StyleDecoratorTest, BlendTwice) {
+  const Color first = Color::RGBA(255, 0, 0, 128);
+  const Color second = Color::RGBA(0, 0, 255, 128);
+
+  Screen screen(4, 1);
+  Render(screen, text("text") | bgcolor(second) | bgcolor(first));
+  EXPECT_EQ(screen.PixelAt(0, 0).background_color,
+            Color::Blend(Color::Blend(Color(), first), second));
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -1,32 +1,66 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <algorithm>  // for min
-#include <memory>     // for make_shared
-#include <sstream>
-#include <string>   // for string, wstring
-#include <utility>  // for move
-
-#include "ftxui/dom/deprecated.hpp"   // for text, vtext
-#include "ftxui/dom/elements.hpp"     // for Element, text, vtext
-#include "ftxui/dom/node.hpp"         // for Node
-#include "ftxui/dom/requirement.hpp"  // for Requirement
-#include "ftxui/dom/selection.hpp"    // for Selection
-#include "ftxui/screen/box.hpp"       // for Box
-#include "ftxui/screen/screen.hpp"    // for Pixel, Screen
-#include "ftxui/screen/string.hpp"  // for string_width, Utf8ToGlyphs, to_string
+#include <algorithm>    // for min
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint32_t
+#include <memory>       // for make_shared
+#include <string>       // for string, wstring
+#include <string_view>  // for string_view
+#include <utility>      // for move
+#include <vector>       // for vector
+
+#include "ftxui/dom/deprecated.hpp"           // for text, vtext
+#include "ftxui/dom/element_arena.hpp"        // for MakeElement
+#include "ftxui/dom/elements.hpp"             // for Element, text, vtext
+#include "ftxui/dom/node.hpp"                 // for Node
+#include "ftxui/dom/requirement.hpp"          // for Requirement
+#include "ftxui/dom/selection.hpp"            // for Selection
+#include "ftxui/screen/box.hpp"               // for Box
+#include "ftxui/screen/screen.hpp"            // for Pixel, Screen
+#include "ftxui/screen/string.hpp"            // for to_string
+#include "ftxui/screen/string_internal.hpp"  // for Utf8ToGlyphEnds
 
 namespace ftxui {
 
 namespace {
 using ftxui::Screen;
 
+// The cells of a text, split once and reused by every layout iteration and
+// by the drawing.
+class Cells {
+ public:
+  explicit Cells(std::string text) : bytes_(std::move(text)) {}
+
+  size_t size() {
+    Split();
+    return ends_.size();
+  }
+
+  std::string_view operator[](size_t i) const {
+    const uint32_t begin = i == 0 ? 0 : ends_[i - 1];
+    return {bytes_.data() + begin, size_t(ends_[i] - begin)};
+  }
+
+ private:
+  void Split() {
+    if (!split_) {
+      ends_ = Utf8ToGlyphEnds(bytes_);
+      split_ = true;
+    }
+  }
+
+  std::string bytes_;
+  std::vector<uint32_t> ends_;
+  bool split_ = false;
+};
+
 class Text : public Node {
  public:
-  explicit Text(std::string text) : text_(std::move(text)) {}
+  explicit Text(std::string text) : cells_(std::move(text)) {}
 
   void ComputeRequirement() override {
-    requirement_.min_x = string_width(text_);
+    requirement_.min_x = int(cells_.size());
     requirement_.min_y = 1;
     has_selection = false;
   }
@@ -42,18 +76,18 @@ class Text : public Node {
     selection_start_ = selection_saturated.GetBox().x_min;
     selection_end_ = selection_saturated.GetBox().x_max;
 
-    std::stringstream ss;
+    std::string part;
     int x = box_.x_min;
-    for (const auto& cell : Utf8ToGlyphs(text_)) {
-      if (cell == "\n") {
+    for (size_t i = 0; i < cells_.size(); ++i) {
+      if (cells_[i] == "\n") {
         continue;
       }
       if (selection_start_ <= x && x <= selection_end_) {
-        ss << cell;
+        part += cells_[i];
       }
       x++;
     }
-    selection.AddPart(ss.str(), box_.y_min, selection_start_, selection_end_);
+    selection.AddPart(part, box_.y_min, selection_start_, selection_end_);
   }
 
   void Render(Screen& screen) override {
@@ -64,14 +98,14 @@ class Text : public Node {
       return;
     }
 
-    for (const auto& cell : Utf8ToGlyphs(text_)) {
+    for (size_t i = 0; i < cells_.size(); ++i) {
       if (x > box_.x_max) {
         break;
       }
-      if (cell == "\n") {
+      if (cells_[i] == "\n") {
         continue;
       }
-      screen.PixelAt(x, y).character = cell;
+      screen.PixelAt(x, y).character = cells_[i];
 
       if (has_selection) {
         auto selectionTransform = screen.GetSelectionStyle();
@@ -85,7 +119,7 @@ class Text : public Node {
   }
 
  private:
-  std::string text_;
+  Cells cells_;
   bool has_selection = false;
   int selection_start_ = 0;
   int selection_end_ = -1;
@@ -93,32 +127,32 @@ class Text : public Node {
 
 class VText : public Node {
  public:
-  explicit VText(std::string text)
-      : text_(std::move(text)), width_{std::min(string_width(text_), 1)} {}
+  explicit VText(std::string text) : cells_(std::move(text)) {}
 
   void ComputeRequirement() override {
-    requirement_.min_x = width_;
-    requirement_.min_y = string_width(text_);
+    requirement_.min_x = Width();
+    requirement_.min_y = int(cells_.size());
   }
 
   void Render(Screen& screen) override {
     const int x = box_.x_min;
     int y = box_.y_min;
-    if (x + width_ - 1 > box_.x_max) {
+    if (x + Width() - 1 > box_.x_max) {
       return;
     }
-    for (const auto& it : Utf8ToGlyphs(text_)) {
+    for (size_t i = 0; i < cells_.size(); ++i) {
       if (y > box_.y_max) {
         return;
       }
-      screen.PixelAt(x, y).character = it;
+      screen.PixelAt(x, y).character = cells_[i];
       y += 1;
     }
   }
 
  private:
-  std::string text_;
-  int width_ = 1;
+  int Width() { return std::min(int(cells_.size()), 1); }
+
+  Cells cells_;
 };
 
 }  // namespace
@@ -139,7 +173,7 @@ class VText : public Node {
 /// Hello world!
 /// ```
 Element text(std::string text) {
-  return std::make_shared<Text>(std::move(text));
+  return MakeElement<Text>(std::move(text));
 }
 
 /// @brief Display a piece of unicode text.
@@ -158,7 +192,7 @@ Element text(std::string text) {
 /// Hello world!
 /// ```
 Element text(std::wstring text) {  // NOLINT
-  return std::make_shared<Text>(to_string(text));
+  return MakeElement<Text>(to_string(text));
 }
 
 /// @brief Display a piece of unicode text vertically.
@@ -188,7 +222,7 @@ Element text(std::wstring text) {  // NOLINT
 /// !
 /// ```
 Element vtext(std::string text) {
-  return std::make_shared<VText>(std::move(text));
+  return MakeElement<VText>(std::move(text));
 }
 
 /// @brief Display a piece unicode text vertically.
@@ -218,7 +252,7 @@ Element vtext(std::string text) {
 /// !
 /// ```
 Element vtext(std::wstring text) {  // NOLINT
-  return std::make_shared<VText>(to_string(text));
+  return MakeElement<VText>(to_string(text));
 }
 
 }  // namespace ftxui
@@ -0,0 +1,128 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <algorithm>   // for max, min
+#include <climits>     // for INT_MAX
+#include <cstdint>     // for int64_t
+#include <functional>  // for function
+#include <map>         // for map
+#include <utility>     // for move
+
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
+#include "ftxui/dom/elements.hpp"       // for Element, virtualList, emptyElement
+#include "ftxui/dom/node.hpp"           // for Node
+#include "ftxui/dom/node_layout.hpp"    // for Layout
+#include "ftxui/dom/requirement.hpp"    // for Requirement
+#include "ftxui/dom/selection.hpp"      // for Selection
+#include "ftxui/screen/box.hpp"         // for Box
+#include "ftxui/screen/screen.hpp"      // for Screen
+
+namespace ftxui {
+
+namespace {
+class VirtualList : public Node {
+ public:
+  VirtualList(int count,
+              int row_height,
+              std::function<Element(int)> generator)
+      : count_(std::max(0, count)),
+        row_height_(std::max(1, row_height)),
+        generator_(std::move(generator)) {}
+
+  void ComputeRequirement() override {
+    // The width of the rows is unknown until they are built. The list takes
+    // the width it is given instead.
+    const int64_t height = int64_t(count_) * int64_t(row_height_);
+    requirement_ = Requirement{};
+    requirement_.min_x = 0;
+    requirement_.min_y = int(std::min<int64_t>(height, INT_MAX));
+    requirement_.flex_grow_x = 1;
+    requirement_.flex_shrink_x = 1;
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    rows_.clear();
+  }
+
+  void Select(Selection& selection) override {
+    const Box box = Box::Intersection(selection.GetBox(), box_);
+    ForEachRow(box.y_min, box.y_max,
+               [&](Element& row) { row->Select(selection); });
+  }
+
+  void Render(Screen& screen) override {
+    const Box box = Box::Intersection(screen.stencil, box_);
+    ForEachRow(box.y_min, box.y_max,
+               [&](Element& row) { row->Render(screen); });
+  }
+
+ private:
+  // Visit the rows intersecting the lines [y_min, y_max], building them if
+  // needed.
+  template <class Function>
+  void ForEachRow(int y_min, int y_max, Function function) {
+    if (y_min > y_max) {
+      return;
+    }
+    const int first = std::max(0, (y_min - box_.y_min) / row_height_);
+    const int last = std::min(count_ - 1, (y_max - box_.y_min) / row_height_);
+    for (int index = first; index <= last; ++index) {
+      function(Row(index));
+    }
+  }
+
+  Element& Row(int index) {
+    Element& row = rows_[index];
+    if (row) {
+      return row;
+    }
+
+    row = generator_(index);
+    if (!row) {
+      row = emptyElement();
+    }
+
+    Box box = box_;
+    box.y_min = box_.y_min + index * row_height_;
+    box.y_max = box.y_min + row_height_ - 1;
+
+    Layout(row.get(), box);
+    return row;
+  }
+
+  const int count_;
+  const int row_height_;
+  const std::function<Element(int)> generator_;
+
+  // The rows built for the current box, by index.
+  std::map<int, Element> rows_;
+};
+}  // namespace
+
+/// @brief A vertical list of rows, built on demand.
+///
+/// Only the rows visible on the screen are built, by calling the generator.
+/// Inside a `yframe`, drawing a list of a million rows costs the same as
+/// drawing the few visible ones. The list is scrolled using `focusPosition`.
+///
+/// @param count The number of rows.
+/// @param row_height The height of every row.
+/// @param generator Build the row at the given index.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// Element document =
+///     virtualList(int(lines.size()), 1,
+///                 [&](int i) { return text(lines[i]); }) |
+///     focusPosition(0, selected) | yframe;
+/// ```
+Element virtualList(int count,
+                    int row_height,
+                    std::function<Element(int)> generator) {
+  return MakeElement<VirtualList>(count, row_height, std::move(generator));
+}
+
+}  // namespace ftxui
@@ -0,0 +1,97 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for string, to_string
+#include <vector>  // for vector
+
+#include "ftxui/dom/elements.hpp"   // for text, virtualList, yframe, vbox
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(VirtualListTest, OnlyVisibleRowsAreBuilt) {
+  std::vector<int> built;
+  auto element = virtualList(1000000, 1, [&](int i) {
+                   built.push_back(i);
+                   return text(std::to_string(i));
+                 }) |
+                 focusPosition(0, 500000) | yframe;
+
+  Screen screen(7, 3);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "499999 \r\n"
+            "500000 \r\n"
+            "500001 ");
+  EXPECT_EQ(built, (std::vector<int>{499999, 500000, 500001}));
+}
+
+TEST(VirtualListTest, SameAsVbox) {
+  auto row = [](int i) {
+    return hbox({text("row "), text(std::to_string(i)) | bold});
+  };
+  Elements rows;
+  for (int i = 0; i < 50; ++i) {
+    rows.push_back(row(i));
+  }
+
+  for (int position : {0, 10, 25, 49}) {
+    Screen expected(8, 5);
+    Render(expected, vbox(rows) | focusPosition(0, position) | yframe);
+
+    Screen screen(8, 5);
+    Render(screen, virtualList(50, 1, row) | focusPosition(0, position) |
+                       yframe);
+    EXPECT_EQ(screen.ToString(), expected.ToString());
+  }
+}
+
+TEST(VirtualListTest, RowHeight) {
+  auto element = virtualList(100, 2,
+                             [](int i) {
+                               return vbox({
+                                   text("row " + std::to_string(i)),
+                                   separator(),
+                               });
+                             }) |
+                 focusPosition(0, 20) | yframe;
+  Screen screen(6, 4);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "──────\r\n"
+            "row 10\r\n"
+            "──────\r\n"
+            "row 11");
+}
+
+TEST(VirtualListTest, Empty) {
+  int built = 0;
+  auto element = virtualList(0, 1, [&](int) {
+    built++;
+    return text("x");
+  });
+  Screen screen(3, 2);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(), "   \r\n   ");
+  EXPECT_EQ(built, 0);
+}
+
+TEST(VirtualListTest, Unframed) {
+  auto element = vbox({
+      text("title"),
+      virtualList(2, 1, [](int i) { return text(std::to_string(i)); }),
+  });
+  Screen screen(5, 4);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "title\r\n"
+            "0    \r\n"
+            "1    \r\n"
+            "     ");
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -7,6 +7,7 @@ export import ftxui.screen.box;
 export import ftxui.screen.color;
 export import ftxui.screen.color_info;
 export import ftxui.screen.deprecated;
+export import ftxui.screen.glyph;
 export import ftxui.screen.image;
 export import ftxui.screen.pixel;
 export import ftxui.screen.screen;
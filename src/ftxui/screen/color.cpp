@@ -5,7 +5,9 @@
 
 #include <array>  // for array
 #include <cmath>
+#include <cstddef>  // for size_t
 #include <cstdint>
+#include <cstdlib>  // for abs
 #include <string>
 
 #include "ftxui/screen/color_info.hpp"  // for GetColorInfo, ColorInfo
@@ -32,6 +34,111 @@ const std::array<const char*, 33> palette16code = {
     "97", "107",  //
 };
 
+// Lookup tables finding the closest Palette256 color of an RGB color, among
+// the 6x6x6 color cube [16, 232) and the gray ramp [232, 256). The distance
+// is euclidean, so the closest color of the cube is found independently for
+// each channel, and the closest gray is the one closest to the mean.
+class PaletteQuantizer {
+ public:
+  PaletteQuantizer() {
+    std::array<int, 6> cube_levels = {};
+    for (int i = 0; i < 6; ++i) {
+      cube_levels[i] = GetColorInfo(Color::Palette256(kCubeBegin + i)).blue;
+    }
+    std::array<int, 24> gray_levels = {};  // NOLINT
+    for (int i = 0; i < 24; ++i) {         // NOLINT
+      gray_levels[i] = GetColorInfo(Color::Palette256(kGrayBegin + i)).red;
+    }
+
+    // In case of equal distances, the color with the lowest index is used.
+    for (int value = 0; value < 256; ++value) {  // NOLINT
+      cube_index_[value] = Nearest(cube_levels, value, 1);
+    }
+    for (int sum = 0; sum < 3 * 256 - 2; ++sum) {  // NOLINT
+      gray_index_[sum] = Nearest(gray_levels, sum, 3);
+    }
+    for (int i = 0; i < 6; ++i) {
+      cube_levels_[i] = cube_levels[i];
+    }
+    for (int i = 0; i < 24; ++i) {  // NOLINT
+      gray_levels_[i] = gray_levels[i];
+    }
+  }
+
+  uint8_t Nearest256(uint8_t red, uint8_t green, uint8_t blue) const {
+    const int r = cube_index_[red];
+    const int g = cube_index_[green];
+    const int b = cube_index_[blue];
+    const int cube_distance = Distance(red, green, blue, cube_levels_[r],
+                                       cube_levels_[g], cube_levels_[b]);
+
+    const int gray = gray_index_[red + green + blue];
+    const int level = gray_levels_[gray];
+    const int gray_distance = Distance(red, green, blue, level, level, level);
+
+    if (gray_distance < cube_distance) {
+      return uint8_t(kGrayBegin + gray);
+    }
+    return uint8_t(kCubeBegin + 36 * r + 6 * g + b);  // NOLINT
+  }
+
+ private:
+  static constexpr int kCubeBegin = 16;
+  static constexpr int kGrayBegin = 232;
+
+  // Return the index of the |levels| closest to |value| / |scale|.
+  template <size_t N>
+  static uint8_t Nearest(const std::array<int, N>& levels,
+                         int value,
+                         int scale) {
+    size_t best = 0;
+    for (size_t i = 1; i < N; ++i) {
+      if (std::abs(scale * levels[i] - value) <
+          std::abs(scale * levels[best] - value)) {
+        best = i;
+      }
+    }
+    return uint8_t(best);
+  }
+
+  static int Distance(int r1, int g1, int b1, int r2, int g2, int b2) {
+    return (r1 - r2) * (r1 - r2) + (g1 - g2) * (g1 - g2) +
+           (b1 - b2) * (b1 - b2);
+  }
+
+  std::array<uint8_t, 256> cube_index_ = {};        // NOLINT
+  std::array<uint8_t, 3 * 256 - 2> gray_index_ = {};  // NOLINT
+  std::array<uint8_t, 6> cube_levels_ = {};
+  std::array<uint8_t, 24> gray_levels_ = {};  // NOLINT
+};
+
+// Precomputed fragments of the SGR parameters, so that printing a color only
+// copies bytes.
+struct SGRTables {
+  SGRTables() {
+    for (int i = 0; i < 256; ++i) {  // NOLINT
+      decimal[i] = std::to_string(i);
+      palette256[0][i] = "38;5;" + decimal[i];
+      palette256[1][i] = "48;5;" + decimal[i];
+    }
+  }
+
+  // The decimal representation of each channel value.
+  std::array<std::string, 256> decimal;  // NOLINT
+  // The foreground [0] and background [1] parameters of each Palette256 color.
+  std::array<std::array<std::string, 256>, 2> palette256;  // NOLINT
+};
+
+const SGRTables& GetSGRTables() {
+  static const SGRTables tables;
+  return tables;
+}
+
+const PaletteQuantizer& GetPaletteQuantizer() {
+  static const PaletteQuantizer quantizer;
+  return quantizer;
+}
+
 }  // namespace
 
 bool Color::operator==(const Color& rhs) const {
@@ -43,34 +150,77 @@ bool Color::operator!=(const Color& rhs) const {
   return !operator==(rhs);
 }
 
+/// @brief The SGR parameters selecting this color, for the colors supported
+/// by the terminal. See Terminal::ColorSupport().
+/// @param is_background_color Whether to select the background color, instead
+///                            of the foreground one.
 std::string Color::Print(bool is_background_color) const {
-  if (is_background_color) {
-    switch (type_) {
-      case ColorType::Palette1:
-        return "49";
-      case ColorType::Palette16:
-        return palette16code[2 * red_ + 1];  // NOLINT
-      case ColorType::Palette256:
-        return "48;5;" + std::to_string(red_);
-      case ColorType::TrueColor:
-        return "48;2;" + std::to_string(red_) + ";" + std::to_string(green_) +
-               ";" + std::to_string(blue_);
+  std::string output;
+  Print(is_background_color, output);
+  return output;
+}
+
+/// @brief Append to |output| the SGR parameters selecting this color, for the
+/// colors supported by the terminal. This doesn't allocate, besides growing
+/// |output|.
+/// @param is_background_color Whether to select the background color, instead
+///                            of the foreground one.
+/// @param output The buffer to append to.
+void Color::Print(bool is_background_color, std::string& output) const {
+  const Color color = Quantize();
+  const int background = is_background_color ? 1 : 0;
+  switch (color.type_) {
+    case ColorType::Palette1:
+      output += is_background_color ? "49" : "39";
+      return;
+    case ColorType::Palette16:
+      output += palette16code[2 * color.red_ + background];  // NOLINT
+      return;
+    case ColorType::Palette256:
+      output += GetSGRTables().palette256[background][color.red_];
+      return;
+    case ColorType::TrueColor: {
+      const SGRTables& tables = GetSGRTables();
+      output += is_background_color ? "48;2;" : "38;2;";
+      output += tables.decimal[color.red_];
+      output += ';';
+      output += tables.decimal[color.green_];
+      output += ';';
+      output += tables.decimal[color.blue_];
+      return;
     }
-  } else {
-    switch (type_) {
-      case ColorType::Palette1:
-        return "39";
-      case ColorType::Palette16:
-        return palette16code[2 * red_];  // NOLINT
-      case ColorType::Palette256:
-        return "38;5;" + std::to_string(red_);
-      case ColorType::TrueColor:
-        return "38;2;" + std::to_string(red_) + ";" + std::to_string(green_) +
-               ";" + std::to_string(blue_);
+  }
+}
+
+// Colors are stored as they were built, and only downgraded when printed. This
+// way, blending and interpolating colors remain precise.
+Color Color::Quantize() const {
+  const Terminal::Color support = Terminal::ColorSupport();
+  switch (type_) {
+    case ColorType::Palette1:
+    case ColorType::Palette16:
+      return *this;
+
+    case ColorType::Palette256:
+      if (support >= Terminal::Color::Palette256) {
+        return *this;
+      }
+      return Color::Palette16(GetColorInfo(Color::Palette256(red_)).index_16);
+
+    case ColorType::TrueColor: {
+      if (support == Terminal::Color::TrueColor) {
+        return *this;
+      }
+      const uint8_t index =
+          GetPaletteQuantizer().Nearest256(red_, green_, blue_);
+      if (support == Terminal::Color::Palette256) {
+        return Color::Palette256(index);
+      }
+      return Color::Palette16(GetColorInfo(Color::Palette256(index)).index_16);
     }
   }
   // NOTREACHED();
-  return "";
+  return *this;
 }
 
 /// @brief Build a transparent color.
@@ -85,13 +235,7 @@ Color::Color(Palette16 index)
 
 /// @brief Build a color using Palette256 colors.
 Color::Color(Palette256 index)
-    : type_(ColorType::Palette256), red_(index), alpha_(255) {
-  if (Terminal::ColorSupport() >= Terminal::Color::Palette256) {
-    return;
-  }
-  type_ = ColorType::Palette16;
-  red_ = GetColorInfo(Color::Palette256(red_)).index_16;
-}
+    : type_(ColorType::Palette256), red_(index), alpha_(255) {}
 
 /// @brief Build a Color from its RGB representation.
 /// https://en.wikipedia.org/wiki/RGB_color_model
@@ -105,37 +249,7 @@ Color::Color(uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha)
       red_(red),
       green_(green),
       blue_(blue),
-      alpha_(alpha) {
-  if (Terminal::ColorSupport() == Terminal::Color::TrueColor) {
-    return;
-  }
-
-  // Find the closest Color from the database:
-  const int max_distance = 256 * 256 * 3;
-  int closest = max_distance;
-  int best = 0;
-  const int database_begin = 16;
-  const int database_end = 256;
-  for (int i = database_begin; i < database_end; ++i) {
-    const ColorInfo color_info = GetColorInfo(Color::Palette256(i));
-    const int dr = color_info.red - red;
-    const int dg = color_info.green - green;
-    const int db = color_info.blue - blue;
-    const int dist = dr * dr + dg * dg + db * db;
-    if (closest > dist) {
-      closest = dist;
-      best = i;
-    }
-  }
-
-  if (Terminal::ColorSupport() == Terminal::Color::Palette256) {
-    type_ = ColorType::Palette256;
-    red_ = best;
-  } else {
-    type_ = ColorType::Palette16;
-    red_ = GetColorInfo(Color::Palette256(best)).index_16;
-  }
-}
+      alpha_(alpha) {}
 
 /// @brief Build a Color from its RGB representation.
 /// https://en.wikipedia.org/wiki/RGB_color_model
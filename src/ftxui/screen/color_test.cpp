@@ -3,6 +3,8 @@
 // the LICENSE file.
 #include "ftxui/screen/color.hpp"
 #include <gtest/gtest.h>
+#include <string>  // for to_string
+#include "ftxui/screen/color_info.hpp"
 #include "ftxui/screen/terminal.hpp"
 
 namespace ftxui {
@@ -31,6 +33,19 @@ TEST(ColorTest, PrintTrueCOlor) {
   EXPECT_EQ(Color::RGB(1, 2, 3).Print(true), "48;2;1;2;3");
 }
 
+TEST(ColorTest, PrintAppend) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  std::string output = "prefix";
+  Color::RGB(0, 10, 255).Print(false, output);
+  output += '|';
+  Color(Color::Grey100).Print(true, output);
+  output += '|';
+  Color(Color::RedLight).Print(true, output);
+  output += '|';
+  Color().Print(false, output);
+  EXPECT_EQ(output, "prefix38;2;0;10;255|48;5;231|101|39");
+}
+
 TEST(ColorTest, FallbackTo256) {
   Terminal::SetColorSupport(Terminal::Color::Palette256);
   EXPECT_EQ(Color::RGB(1, 2, 3).Print(false), "38;5;16");
@@ -41,6 +56,44 @@ TEST(ColorTest, FallbackTo16) {
   EXPECT_EQ(Color::RGB(1, 2, 3).Print(false), "30");
 }
 
+TEST(ColorTest, FallbackTo256MatchesClosestColor) {
+  Terminal::SetColorSupport(Terminal::Color::Palette256);
+  // Compare against an exhaustive search of the closest color.
+  for (int r = 0; r < 256; r += 5) {
+    for (int g = 0; g < 256; g += 5) {
+      for (int b = 0; b < 256; b += 5) {
+        int best = 16;
+        int best_distance = 256 * 256 * 3;
+        for (int i = 16; i < 256; ++i) {
+          const ColorInfo info = GetColorInfo(Color::Palette256(i));
+          const int distance = (info.red - r) * (info.red - r) +
+                               (info.green - g) * (info.green - g) +
+                               (info.blue - b) * (info.blue - b);
+          if (distance < best_distance) {
+            best_distance = distance;
+            best = i;
+          }
+        }
+        ASSERT_EQ(Color::RGB(r, g, b).Print(false),
+                  "38;5;" + std::to_string(best))
+            << r << " " << g << " " << b;
+      }
+    }
+  }
+}
+
+TEST(ColorTest, FallbackAtPrintTime) {
+  // The color is downgraded when printed, not when built.
+  Terminal::SetColorSupport(Terminal::Color::Palette16);
+  const Color color = Color::RGB(1, 2, 3);
+  const Color palette = Color::Palette256(52);
+  EXPECT_EQ(color.Print(false), "30");
+  EXPECT_EQ(palette.Print(false), "31");
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  EXPECT_EQ(color.Print(false), "38;2;1;2;3");
+  EXPECT_EQ(palette.Print(false), "38;5;52");
+}
+
 TEST(ColorTest, Litterals) {
   Terminal::SetColorSupport(Terminal::Color::TrueColor);
   using namespace ftxui::literals;
@@ -0,0 +1,227 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/screen/glyph.hpp"
+
+#include <algorithm>      // for find, copy
+#include <array>          // for array
+#include <atomic>         // for atomic, memory_order_acquire
+#include <cstdint>        // for uint32_t, uint64_t
+#include <cstring>        // for memcpy
+#include <memory>         // for unique_ptr, make_unique
+#include <mutex>          // for mutex, lock_guard
+#include <ostream>        // for ostream
+#include <string>         // for string
+#include <string_view>    // for string_view
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for move
+
+#include "ftxui/screen/string.hpp"  // for string_width
+
+namespace ftxui {
+
+namespace {
+
+// The graphemes too long to be stored inline, grouped in generations. The id
+// of an interned grapheme holds its generation in the upper 8 bits, and its
+// index in the lower 24 bits. Release() starts a new generation and frees the
+// one before the current one. Reading a grapheme of a freed generation returns
+// an empty string.
+//
+// Within a generation, the strings are stored in chunks that are never moved:
+// the chunk k holds the indices [2^k - 1, 2^(k+1) - 1). Reading an interned
+// grapheme doesn't lock, only interning a new one does.
+class InternTable {
+ public:
+  InternTable() { StartGeneration(0); }
+
+  uint32_t Intern(std::string_view str) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    Generation& current = *owners_[generation() % 2];
+    auto it = current.ids.find(str);
+    if (it != current.ids.end()) {
+      return Id(it->second);
+    }
+
+    const uint32_t index = current.size.load(std::memory_order_relaxed);
+    if (index == kIndexMask) {
+      return Id(kIndexMask);  // The generation is full. Read as empty.
+    }
+    const int chunk = Chunk(index);
+    if (!current.owners[size_t(chunk)]) {
+      current.owners[size_t(chunk)] =
+          std::make_unique<std::string[]>(size_t(1) << chunk);
+      current.chunks[size_t(chunk)].store(
+          current.owners[size_t(chunk)].get(), std::memory_order_release);
+    }
+    std::string& string = current.owners[size_t(chunk)][Offset(index, chunk)];
+    string = str;
+    current.ids.emplace(string, index);
+    current.size.store(index + 1, std::memory_order_release);
+    return Id(index);
+  }
+
+  std::string_view Get(uint32_t id) const {
+    const uint32_t number = id >> kIndexBits;
+    const Generation* generation =
+        generations_[number % 2].load(std::memory_order_acquire);
+    if (!generation || generation->number != number) {
+      return {};
+    }
+    const uint32_t index = id & kIndexMask;
+    if (index >= generation->size.load(std::memory_order_acquire)) {
+      return {};
+    }
+    const int chunk = Chunk(index);
+    const std::string* strings =
+        generation->chunks[size_t(chunk)].load(std::memory_order_acquire);
+    return strings[Offset(index, chunk)];
+  }
+
+  void Release() {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    StartGeneration((generation() + 1) % kGenerations);
+  }
+
+  size_t size() const {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    return owners_[generation() % 2]->size.load(std::memory_order_relaxed);
+  }
+
+  uint32_t generation() const {
+    return number_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  static constexpr int kIndexBits = 24;
+  static constexpr uint32_t kIndexMask = (uint32_t(1) << kIndexBits) - 1;
+  static constexpr uint32_t kGenerations = 256;
+  static constexpr int kMaxChunks = kIndexBits;
+
+  struct Generation {
+    explicit Generation(uint32_t n) : number(n) {}
+    const uint32_t number;
+    std::unordered_map<std::string_view, uint32_t> ids;
+    std::array<std::unique_ptr<std::string[]>, kMaxChunks> owners;
+    std::atomic<uint32_t> size{0};
+    std::array<std::atomic<const std::string*>, kMaxChunks> chunks{};
+  };
+
+  // Replace the generation before the current one.
+  void StartGeneration(uint32_t number) {
+    number_.store(number, std::memory_order_relaxed);
+    auto generation = std::make_unique<Generation>(number);
+    generations_[number % 2].store(generation.get(), std::memory_order_release);
+    owners_[number % 2] = std::move(generation);
+  }
+
+  uint32_t Id(uint32_t index) const {
+    return (number_.load(std::memory_order_relaxed) << kIndexBits) | index;
+  }
+
+  static int Chunk(uint32_t index) {
+    int chunk = 0;
+    for (uint64_t value = uint64_t(index) + 1; value > 1; value >>= 1) {
+      ++chunk;
+    }
+    return chunk;
+  }
+
+  static size_t Offset(uint32_t index, int chunk) {
+    return size_t(uint64_t(index) + 1 - (uint64_t(1) << chunk));
+  }
+
+  mutable std::mutex mutex_;
+  std::atomic<uint32_t> number_{0};
+  std::array<std::unique_ptr<Generation>, 2> owners_;
+  std::array<std::atomic<const Generation*>, 2> generations_{};
+};
+
+InternTable& GetInternTable() {
+  static InternTable table;
+  return table;
+}
+
+// The number of cells |str| occupies on the terminal.
+int Width(std::string_view str) {
+  // Fast path for ASCII: only the control characters have no width.
+  int width = 0;
+  for (const char c : str) {
+    const auto byte = static_cast<unsigned char>(c);
+    if (byte >= 0x80) {  // NOLINT
+      return string_width(std::string(str));
+    }
+    width += int(byte >= 32 && byte != 127);  // NOLINT
+  }
+  return width;
+}
+
+}  // namespace
+
+/// @brief Build a Glyph from a string. It should contain a single grapheme.
+Glyph::Glyph(const char* str) : Glyph(std::string_view(str)) {}
+
+/// @brief Build a Glyph from a string. It should contain a single grapheme.
+Glyph::Glyph(const std::string& str) : Glyph(std::string_view(str)) {}
+
+/// @brief Build a Glyph from a string. It should contain a single grapheme.
+Glyph::Glyph(std::string_view str) : Glyph(str, Width(str)) {}
+
+/// @brief Build a Glyph from a string whose width is already known.
+/// @param str The grapheme.
+/// @param width The number of terminal cells the grapheme occupies.
+Glyph::Glyph(std::string_view str, int width)
+    : width_(static_cast<uint8_t>(width)) {
+  const bool fits_inline = str.size() <= bytes_.size() &&
+                           str.find('\0') == std::string_view::npos &&
+                           (str.empty() || str[0] != kInterned);
+  if (fits_inline) {
+    std::copy(str.begin(), str.end(), bytes_.begin());
+    return;
+  }
+
+  const uint32_t id = GetInternTable().Intern(str);
+  bytes_[0] = kInterned;
+  std::memcpy(bytes_.data() + 4, &id, sizeof(id));
+}
+
+/// @brief The content of the Glyph.
+std::string_view Glyph::view() const {
+  if (bytes_[0] != kInterned) {
+    const auto* end = std::find(bytes_.begin(), bytes_.end(), '\0');
+    return {bytes_.data(), size_t(end - bytes_.begin())};
+  }
+
+  uint32_t id = 0;
+  std::memcpy(&id, bytes_.data() + 4, sizeof(id));
+  return GetInternTable().Get(id);
+}
+
+/// @brief Release the long graphemes interned before the previous call.
+///
+/// The graphemes too long to be stored inline are interned into a process wide
+/// table. Calling this function bounds its size: the Glyphs interned since the
+/// previous call remain valid, the older ones are read as empty strings.
+/// ScreenInteractive calls it in between two frames, once the table is large.
+///
+/// It must not be called while another thread uses a Glyph.
+void Glyph::ReleaseInterned() {
+  GetInternTable().Release();
+}
+
+/// @brief The number of graphemes interned since the last ReleaseInterned().
+size_t Glyph::InternedCount() {
+  return GetInternTable().size();
+}
+
+/// @brief The number of calls to ReleaseInterned(), modulo 256. The Glyphs
+/// built while it had another value may be read as empty strings.
+uint32_t Glyph::InternedGeneration() {
+  return GetInternTable().generation();
+}
+
+std::ostream& operator<<(std::ostream& out, const Glyph& glyph) {
+  return out << glyph.view();
+}
+
+}  // namespace ftxui
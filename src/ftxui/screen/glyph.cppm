@@ -0,0 +1,16 @@
+/// @module ftxui.screen.glyph
+/// @brief Module file for the Glyph class of the Screen module
+
+module;
+
+#include <ftxui/screen/glyph.hpp>
+
+export module ftxui.screen.glyph;
+
+/**
+ * @namespace ftxui
+ * @brief The FTXUI ftxui:: namespace
+ */
+export namespace ftxui {
+    using ftxui::Glyph;
+}
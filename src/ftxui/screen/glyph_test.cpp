@@ -0,0 +1,130 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/screen/glyph.hpp"
+#include <gtest/gtest.h>
+#include <sstream>  // for stringstream
+#include <string>   // for allocator, string, to_string
+#include <thread>   // for thread
+#include <vector>   // for vector
+#include "ftxui/screen/pixel.hpp"
+
+namespace ftxui {
+
+TEST(GlyphTest, Empty) {
+  Glyph glyph;
+  EXPECT_TRUE(glyph.empty());
+  EXPECT_EQ(glyph.size(), 0u);
+  EXPECT_EQ(glyph, "");
+  EXPECT_EQ(glyph, Glyph(""));
+}
+
+TEST(GlyphTest, Inline) {
+  for (const std::string str : {"a", "測", "┌", "😀", "12345678"}) {
+    const Glyph glyph = str;
+    EXPECT_FALSE(glyph.empty());
+    EXPECT_EQ(glyph.size(), str.size());
+    EXPECT_EQ(glyph.view(), str);
+    EXPECT_EQ(glyph.str(), str);
+    EXPECT_EQ(glyph, str);
+  }
+}
+
+TEST(GlyphTest, Interned) {
+  // A family: 4 emojis joined by zero width joiners. 25 bytes.
+  const std::string family = "👨‍👩‍👧‍👦";
+  const Glyph a = family;
+  const Glyph b = family;
+  EXPECT_EQ(a.view(), family);
+  EXPECT_EQ(a.size(), family.size());
+  EXPECT_EQ(a, b);
+  EXPECT_NE(a, Glyph("👨"));
+  EXPECT_NE(a, Glyph("👨‍👩‍👧"));
+}
+
+TEST(GlyphTest, InternedMany) {
+  // Enough long graphemes to fill several chunks of the intern table.
+  std::vector<Glyph> glyphs;
+  for (int i = 0; i < 5000; ++i) {
+    glyphs.emplace_back("long grapheme " + std::to_string(i));
+  }
+  for (int i = 0; i < 5000; ++i) {
+    EXPECT_EQ(glyphs[size_t(i)].view(), "long grapheme " + std::to_string(i));
+    EXPECT_EQ(glyphs[size_t(i)], Glyph("long grapheme " + std::to_string(i)));
+  }
+}
+
+TEST(GlyphTest, InternedConcurrently) {
+  const Glyph family = "👨‍👩‍👧‍👦";
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([t, &family] {
+      for (int i = 0; i < 1000; ++i) {
+        const std::string str =
+            "thread " + std::to_string(t) + " " + std::to_string(i);
+        EXPECT_EQ(Glyph(str).view(), str);
+        EXPECT_EQ(family.view(), "👨‍👩‍👧‍👦");
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+TEST(GlyphTest, ReleaseInterned) {
+  const std::string family = "👨‍👩‍👧‍👦";
+  const Glyph old_glyph = family;
+  Glyph::ReleaseInterned();
+  EXPECT_EQ(Glyph::InternedCount(), 0u);
+
+  // The graphemes interned before the last release remain valid.
+  const Glyph glyph = family;
+  EXPECT_EQ(Glyph::InternedCount(), 1u);
+  EXPECT_EQ(old_glyph.view(), family);
+  EXPECT_EQ(glyph.view(), family);
+
+  // The older ones are read as empty.
+  const uint32_t generation = Glyph::InternedGeneration();
+  Glyph::ReleaseInterned();
+  EXPECT_EQ(Glyph::InternedGeneration(), (generation + 1) % 256);
+  EXPECT_EQ(old_glyph.view(), "");
+  EXPECT_EQ(glyph.view(), family);
+  EXPECT_EQ(Glyph(family).view(), family);
+
+  // The inline graphemes are never released.
+  const Glyph inline_glyph = "測";
+  Glyph::ReleaseInterned();
+  Glyph::ReleaseInterned();
+  EXPECT_EQ(inline_glyph.view(), "測");
+}
+
+TEST(GlyphTest, Compare) {
+  EXPECT_EQ(Glyph("a"), Glyph("a"));
+  EXPECT_NE(Glyph("a"), Glyph("b"));
+  EXPECT_NE(Glyph("a"), Glyph("ab"));
+  EXPECT_NE(Glyph("a"), Glyph(""));
+}
+
+TEST(GlyphTest, Width) {
+  EXPECT_EQ(Glyph().width(), 0);
+  EXPECT_EQ(Glyph("a").width(), 1);
+  EXPECT_EQ(Glyph("\t").width(), 0);
+  EXPECT_EQ(Glyph("┌").width(), 1);
+  EXPECT_EQ(Glyph("測").width(), 2);
+  EXPECT_EQ(Glyph("e\u0301").width(), 1);  // e + combining acute accent.
+  EXPECT_EQ(Glyph("⣿", 1).width(), 1);
+}
+
+TEST(GlyphTest, Stream) {
+  std::stringstream ss;
+  ss << Glyph("a") << Glyph("👨‍👩‍👧‍👦");
+  EXPECT_EQ(ss.str(), "a👨‍👩‍👧‍👦");
+}
+
+TEST(GlyphTest, PixelIsCompact) {
+  // 9 bytes for the glyph, 10 bytes for the colors, the rest for the style.
+  EXPECT_LE(sizeof(Pixel), 24u);
+}
+
+}  // namespace ftxui
@@ -1,10 +1,15 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <sstream>  // IWYU pragma: keep
-#include <string>
+#include <algorithm>    // for fill, max, min
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint8_t
+#include <string>       // for string
 #include <vector>
 
+#include "ftxui/screen/box.hpp"
+#include "ftxui/screen/color.hpp"
+#include "ftxui/screen/glyph.hpp"
 #include "ftxui/screen/image.hpp"
 #include "ftxui/screen/pixel.hpp"
 
@@ -15,49 +20,221 @@ Pixel& dev_null_pixel() {
   static Pixel pixel;
   return pixel;
 }
+
+std::string& dev_null_character() {
+  static std::string character;
+  return character;
+}
+
+// Clip the row |y| in between |x_min| and |x_max| against the stencil and the
+// image. Return the index of its first pixel, and its length.
+template <typename Span, typename Pixels>
+Span Clip(const Box& stencil,
+          int dimx,
+          int dimy,
+          Pixels& pixels,
+          int y,
+          int x_min,
+          int x_max) {
+  if (y < std::max(stencil.y_min, 0) || y > std::min(stencil.y_max, dimy - 1)) {
+    return {};
+  }
+  x_min = std::max({x_min, stencil.x_min, 0});
+  x_max = std::min({x_max, stencil.x_max, dimx - 1});
+  if (x_min > x_max) {
+    return {};
+  }
+  return {pixels.data() + size_t(y) * size_t(dimx) + size_t(x_min),
+          size_t(x_max - x_min + 1)};
+}
 }  // namespace
 
 Image::Image(int dimx, int dimy)
     : stencil{0, dimx - 1, 0, dimy - 1},
       dimx_(dimx),
       dimy_(dimy),
-      pixels_(dimy, std::vector<Pixel>(dimx)) {}
+      pixels_(size_t(std::max(dimx, 0)) * size_t(std::max(dimy, 0))),
+      modified_rows_(size_t(std::max(dimy, 0))) {}
 
 /// @brief Access a character in a cell at a given position.
+///
+/// The pixels store a Glyph. The returned string is a copy, written back into
+/// the pixel by the next access to the image, other than at(). The reference
+/// is invalidated then.
 /// @param x The cell position along the x-axis.
 /// @param y The cell position along the y-axis.
+/// @deprecated Use `PixelAt(x, y).character` instead.
 std::string& Image::at(int x, int y) {
-  return PixelAt(x, y).character;
+  if (!stencil.Contain(x, y)) {
+    return dev_null_character();
+  }
+  const size_t index = size_t(y) * size_t(dimx_) + size_t(x);
+  auto it = characters_.find(index);
+  if (it == characters_.end()) {
+    it = characters_.emplace(index, pixels_[index].character.str()).first;
+  }
+  return it->second;
 }
 
 /// @brief Access a character in a cell at a given position.
+///
+/// The returned string is a copy, invalidated by the next access to the image,
+/// other than at().
 /// @param x The cell position along the x-axis.
 /// @param y The cell position along the y-axis.
+/// @deprecated Use `PixelAt(x, y).character` instead.
 const std::string& Image::at(int x, int y) const {
-  return PixelAt(x, y).character;
+  if (!stencil.Contain(x, y)) {
+    return dev_null_character();
+  }
+  const size_t index = size_t(y) * size_t(dimx_) + size_t(x);
+  auto it = characters_.find(index);
+  if (it != characters_.end()) {
+    return it->second;
+  }
+  it = read_characters_.find(index);
+  if (it == read_characters_.end()) {
+    it = read_characters_.emplace(index, pixels_[index].character.str()).first;
+  }
+  return it->second;
 }
 
 /// @brief Access a cell (Pixel) at a given position.
 /// @param x The cell position along the x-axis.
 /// @param y The cell position along the y-axis.
 Pixel& Image::PixelAt(int x, int y) {
-  return stencil.Contain(x, y) ? pixels_[y][x] : dev_null_pixel();
+  CommitCharacters();
+  if (!stencil.Contain(x, y)) {
+    return dev_null_pixel();
+  }
+  modified_rows_[size_t(y)] = 1;
+  return pixels_[size_t(y) * size_t(dimx_) + size_t(x)];
 }
 
 /// @brief Access a cell (Pixel) at a given position.
 /// @param x The cell position along the x-axis.
 /// @param y The cell position along the y-axis.
 const Pixel& Image::PixelAt(int x, int y) const {
-  return stencil.Contain(x, y) ? pixels_[y][x] : dev_null_pixel();
+  CommitCharacters();
+  return stencil.Contain(x, y) ? pixels_[size_t(y) * size_t(dimx_) + size_t(x)]
+                                : dev_null_pixel();
+}
+
+/// @brief Access the pixels of a row, clipped by the stencil.
+/// The stencil is checked once for the whole row, the returned pixels can
+/// then be accessed without any bound checks.
+/// @param y The row position along the y-axis.
+/// @param x_min The first cell position along the x-axis.
+/// @param x_max The last cell position along the x-axis (inclusive).
+PixelSpan Image::RowAt(int y, int x_min, int x_max) {
+  CommitCharacters();
+  const PixelSpan row =
+      Clip<PixelSpan>(stencil, dimx_, dimy_, pixels_, y, x_min, x_max);
+  if (!row.empty()) {
+    modified_rows_[size_t(y)] = 1;
+  }
+  return row;
+}
+
+/// @brief Access the pixels of a row, clipped by the stencil.
+/// @param y The row position along the y-axis.
+/// @param x_min The first cell position along the x-axis.
+/// @param x_max The last cell position along the x-axis (inclusive).
+ConstPixelSpan Image::RowAt(int y, int x_min, int x_max) const {
+  CommitCharacters();
+  return Clip<ConstPixelSpan>(stencil, dimx_, dimy_, pixels_, y, x_min, x_max);
+}
+
+/// @brief Apply a style to every pixel of a rectangle, clipped by the stencil.
+///
+/// This is the bulk equivalent of modifying every `PixelAt(x, y)` of the
+/// rectangle. The stencil is checked once per row, and the inner loops are
+/// free of branches.
+/// @param box The rectangle to style.
+/// @param style The style to apply.
+void Image::ApplyStyle(const Box& box, const PixelStyle& style) {
+  const bool has_attributes = style.blink || style.bold || style.dim ||
+                              style.italic || style.underlined ||
+                              style.underlined_double || style.strikethrough ||
+                              style.automerge || style.inverted;
+  const bool has_background = style.background_color.has_value();
+  const bool has_foreground = style.foreground_color.has_value();
+  const Color background = style.background_color.value_or(Color());
+  const Color foreground = style.foreground_color.value_or(Color());
+  const bool blend_background = has_background && !background.IsOpaque();
+  const bool blend_foreground = has_foreground && !foreground.IsOpaque();
+
+  for (int y = box.y_min; y <= box.y_max; ++y) {
+    const PixelSpan row = RowAt(y, box.x_min, box.x_max);
+
+    if (has_attributes) {
+      for (Pixel& pixel : row) {
+        pixel.blink = pixel.blink | style.blink;
+        pixel.bold = pixel.bold | style.bold;
+        pixel.dim = pixel.dim | style.dim;
+        pixel.italic = pixel.italic | style.italic;
+        pixel.underlined = pixel.underlined | style.underlined;
+        pixel.underlined_double =
+            pixel.underlined_double | style.underlined_double;
+        pixel.strikethrough = pixel.strikethrough | style.strikethrough;
+        pixel.automerge = pixel.automerge | style.automerge;
+        pixel.inverted = pixel.inverted != style.inverted;
+      }
+    }
+
+    if (blend_background) {
+      for (Pixel& pixel : row) {
+        pixel.background_color =
+            Color::Blend(pixel.background_color, background);
+      }
+    } else if (has_background) {
+      for (Pixel& pixel : row) {
+        pixel.background_color = background;
+      }
+    }
+
+    if (blend_foreground) {
+      for (Pixel& pixel : row) {
+        pixel.foreground_color =
+            Color::Blend(pixel.foreground_color, foreground);
+      }
+    } else if (has_foreground) {
+      for (Pixel& pixel : row) {
+        pixel.foreground_color = foreground;
+      }
+    }
+  }
 }
 
 /// @brief Clear all the pixel from the screen.
 void Image::Clear() {
-  for (auto& line : pixels_) {
-    for (auto& cell : line) {
-      cell = Pixel();
-    }
+  std::fill(pixels_.begin(), pixels_.end(), Pixel());
+  std::fill(modified_rows_.begin(), modified_rows_.end(), 0);
+  characters_.clear();
+  read_characters_.clear();
+}
+
+/// @brief Write back the strings returned by the non const at() into the
+/// pixels, and release the ones returned by the const at().
+void Image::CommitCharacters() const {
+  if (characters_.empty() && read_characters_.empty()) {
+    return;
+  }
+  read_characters_.clear();
+  if (characters_.empty()) {
+    return;
+  }
+
+  // Only the non const at() records a string to write back, so the image
+  // isn't const.
+  auto& pixels = const_cast<std::vector<Pixel>&>(pixels_);  // NOLINT
+  auto& modified_rows = const_cast<std::vector<uint8_t>&>(  // NOLINT
+      modified_rows_);
+  for (const auto& [index, character] : characters_) {
+    pixels[index].character = character;
+    modified_rows[index / size_t(dimx_)] = 1;
   }
+  characters_.clear();
 }
 
 }  // namespace ftxui
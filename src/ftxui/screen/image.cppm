@@ -12,5 +12,8 @@ export module ftxui.screen.image;
  * @brief The FTXUI ftxui:: namespace
  */
 export namespace ftxui {
+    using ftxui::BasicPixelSpan;
+    using ftxui::ConstPixelSpan;
     using ftxui::Image;
+    using ftxui::PixelSpan;
 }
@@ -0,0 +1,136 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/screen/image.hpp"
+#include <gtest/gtest.h>
+#include <string>  // for string
+#include "ftxui/screen/box.hpp"
+#include "ftxui/screen/color.hpp"
+#include "ftxui/screen/pixel.hpp"
+
+namespace ftxui {
+
+TEST(ImageTest, At) {
+  // The code written when the pixels held a std::string still works.
+  Image image(3, 1);
+  image.at(0, 0) = "a";
+  std::string& character = image.at(1, 0);
+  character = "測";
+  character += "!";
+  image.at(1, 0).append("?");
+  EXPECT_EQ(image.at(1, 0), "測!?");
+  EXPECT_EQ(image.at(0, 0)[0], 'a');
+
+  // The strings are written back into the pixels by the next access.
+  EXPECT_EQ(image.PixelAt(1, 0).character, "測!?");
+  EXPECT_EQ(image.PixelAt(1, 0).character.width(), 4);
+  EXPECT_EQ(image.PixelAt(0, 0).character, "a");
+
+  const Image& const_image = image;
+  EXPECT_EQ(const_image.at(0, 0), "a");
+  image.PixelAt(0, 0).character = "b";
+  EXPECT_EQ(const_image.at(0, 0), "b");
+
+  // Clear() drops the strings not written back yet.
+  image.at(2, 0) = "c";
+  image.Clear();
+  EXPECT_EQ(image.PixelAt(2, 0).character, Pixel().character);
+}
+
+TEST(ImageTest, RowAt) {
+  Image image(5, 3);
+  auto row = image.RowAt(1, 1, 3);
+  ASSERT_EQ(row.size(), 3u);
+  EXPECT_EQ(&row[0], &image.PixelAt(1, 1));
+  EXPECT_EQ(&row[2], &image.PixelAt(3, 1));
+
+  // The pixels are contiguous, row after row.
+  EXPECT_EQ(&image.PixelAt(4, 0) + 1, &image.PixelAt(0, 1));
+}
+
+TEST(ImageTest, RowAtClippedByImage) {
+  Image image(5, 3);
+  EXPECT_EQ(image.RowAt(1, -10, 10).size(), 5u);
+  EXPECT_TRUE(image.RowAt(-1, 0, 4).empty());
+  EXPECT_TRUE(image.RowAt(3, 0, 4).empty());
+  EXPECT_TRUE(image.RowAt(1, 3, 2).empty());
+}
+
+TEST(ImageTest, RowAtClippedByStencil) {
+  Image image(5, 3);
+  image.stencil = Box{1, 2, 1, 1};
+  for (Pixel& pixel : image.RowAt(1, 0, 4)) {
+    pixel.bold = true;
+  }
+  EXPECT_TRUE(image.RowAt(0, 0, 4).empty());
+  EXPECT_TRUE(image.RowAt(2, 0, 4).empty());
+
+  image.stencil = Box{0, 4, 0, 2};
+  EXPECT_FALSE(image.PixelAt(0, 1).bold);
+  EXPECT_TRUE(image.PixelAt(1, 1).bold);
+  EXPECT_TRUE(image.PixelAt(2, 1).bold);
+  EXPECT_FALSE(image.PixelAt(3, 1).bold);
+}
+
+TEST(ImageTest, ApplyStyle) {
+  Image image(4, 3);
+  image.PixelAt(1, 1).inverted = true;
+
+  PixelStyle style;
+  style.bold = true;
+  style.inverted = true;
+  style.foreground_color = Color::Red;
+  image.ApplyStyle(Box{1, 2, 1, 5}, style);
+
+  for (int y = 0; y < 3; ++y) {
+    for (int x = 0; x < 4; ++x) {
+      const Pixel& pixel = image.PixelAt(x, y);
+      const bool inside = x >= 1 && x <= 2 && y >= 1;
+      EXPECT_EQ(pixel.bold, inside);
+      EXPECT_FALSE(pixel.dim);
+      EXPECT_EQ(pixel.foreground_color,
+                inside ? Color(Color::Red) : Color(Color::Default));
+      EXPECT_EQ(pixel.background_color, Color::Default);
+    }
+  }
+
+  // The inversion is toggled.
+  EXPECT_FALSE(image.PixelAt(1, 1).inverted);
+  EXPECT_TRUE(image.PixelAt(2, 1).inverted);
+}
+
+TEST(ImageTest, ApplyStyleBlend) {
+  Image image(1, 1);
+  image.PixelAt(0, 0).background_color = Color::RGB(0, 0, 0);
+
+  PixelStyle style;
+  style.background_color = Color::RGBA(255, 255, 255, 128);
+  image.ApplyStyle(Box{0, 0, 0, 0}, style);
+  EXPECT_EQ(image.PixelAt(0, 0).background_color,
+            Color::Blend(Color::RGB(0, 0, 0), Color::RGBA(255, 255, 255, 128)));
+}
+
+TEST(ImageTest, ApplyStyleClippedByStencil) {
+  Image image(3, 1);
+  image.stencil = Box{1, 1, 0, 0};
+
+  PixelStyle style;
+  style.underlined = true;
+  image.ApplyStyle(Box{0, 2, 0, 0}, style);
+
+  image.stencil = Box{0, 2, 0, 0};
+  EXPECT_FALSE(image.PixelAt(0, 0).underlined);
+  EXPECT_TRUE(image.PixelAt(1, 0).underlined);
+  EXPECT_FALSE(image.PixelAt(2, 0).underlined);
+}
+
+TEST(ImageTest, Clear) {
+  Image image(2, 2);
+  image.at(1, 1) = "a";
+  image.PixelAt(0, 1).bold = true;
+  image.Clear();
+  EXPECT_EQ(image.at(1, 1), "");
+  EXPECT_FALSE(image.PixelAt(0, 1).bold);
+}
+
+}  // namespace ftxui
@@ -13,4 +13,5 @@ export module ftxui.screen.pixel;
  */
 export namespace ftxui {
     using ftxui::Pixel;
+    using ftxui::PixelStyle;
 }
@@ -1,18 +1,28 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <cstddef>  // for size_t
-#include <cstdint>
-#include <iostream>  // for operator<<, stringstream, basic_ostream, flush, cout, ostream
-#include <limits>
-#include <map>      // for _Rb_tree_const_iterator, map, operator!=, operator==
-#include <sstream>  // IWYU pragma: keep
-#include <utility>  // for pair
+#include <algorithm>      // for min
+#include <array>          // for array
+#include <cerrno>         // for errno, EINTR
+#include <cstdlib>        // for abs
+#include <cstddef>        // for size_t
+#include <cstdint>        // for uint16_t
+#include <cstdio>         // for FILE, fwrite
+#include <deque>          // for deque
+#include <functional>     // for ref
+#include <iostream>       // for operator<<, basic_ostream, flush, cout
+#include <limits>         // for numeric_limits
+#include <memory>         // for make_shared
+#include <string>         // for string
+#include <string_view>    // for string_view
+#include <thread>         // for thread
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for pair
+#include <vector>         // for vector
 
 #include "ftxui/screen/image.hpp"  // for Image
 #include "ftxui/screen/pixel.hpp"  // for Pixel
 #include "ftxui/screen/screen.hpp"
-#include "ftxui/screen/string.hpp"    // for string_width
 #include "ftxui/screen/terminal.hpp"  // for Dimensions, Size
 
 #if defined(_WIN32)
@@ -20,7 +30,10 @@
 #ifndef NOMINMAX
 #define NOMINMAX
 #endif
+#include <io.h>  // for _write
 #include <windows.h>
+#else
+#include <unistd.h>  // for write
 #endif
 
 // Macro for hinting that an expression is likely to be false.
@@ -67,61 +80,182 @@ void WindowsEmulateVT100Terminal() {
 }
 #endif
 
+// Append the decimal representation of |value| to |output|, without
+// allocating.
+void AppendNumber(std::string& output, int value) {
+  std::array<char, 12> buffer;  // NOLINT
+  auto* end = buffer.data() + buffer.size();
+  auto* begin = end;
+  const bool negative = value < 0;
+  unsigned int v = negative ? 0u - unsigned(value) : unsigned(value);
+  do {
+    *--begin = char('0' + v % 10);  // NOLINT
+    v /= 10;
+  } while (v != 0);
+  if (negative) {
+    *--begin = '-';  // NOLINT
+  }
+  output.append(begin, end);
+}
+
+// Collect SGR (Select Graphic Rendition) parameters, and emit them as a single
+// escape sequence. E.g. "\x1B[1;4;38;2;r;g;bm".
+class SGRWriter {
+ public:
+  explicit SGRWriter(std::string& output)
+      : output_(output), begin_(output.size()) {
+    output_ += "\x1B[";
+  }
+  ~SGRWriter() {
+    if (output_.size() == begin_ + 2) {
+      output_.resize(begin_);  // Nothing was written.
+    } else {
+      output_ += 'm';
+    }
+  }
+  SGRWriter(const SGRWriter&) = delete;
+  SGRWriter(SGRWriter&&) = delete;
+  SGRWriter& operator=(const SGRWriter&) = delete;
+  SGRWriter& operator=(SGRWriter&&) = delete;
+
+  void Add(const char* parameter) {
+    if (output_.size() != begin_ + 2) {
+      output_ += ';';
+    }
+    output_ += parameter;
+  }
+
+  void Add(const std::string& parameter) {
+    if (output_.size() != begin_ + 2) {
+      output_ += ';';
+    }
+    output_ += parameter;
+  }
+
+ private:
+  std::string& output_;
+  const size_t begin_;
+};
+
+// The SGR parameters of the colors printed last. On terminals with limited
+// colors, the consecutive cells of a gradient differ, but are often printed
+// the same. Comparing the printed colors avoids emitting them again, and the
+// palette is only looked up once per color change.
+class ColorPrinter {
+ public:
+  const std::string& Print(const Color& color, bool is_background_color) {
+    const Terminal::Color support = Terminal::ColorSupport();
+    if (support != support_) {
+      support_ = support;
+      entries_ = {};
+    }
+
+    auto& entries = entries_[is_background_color ? 1 : 0];
+    auto& last = last_[is_background_color ? 1 : 0];
+    for (size_t i = 0; i < entries.size(); ++i) {
+      if (entries[i].valid && entries[i].color == color) {
+        last = i;
+        return entries[i].parameters;
+      }
+    }
+
+    // Replace the entry not used last.
+    last = 1 - last;
+    Entry& entry = entries[last];
+    entry.valid = true;
+    entry.color = color;
+    entry.parameters.clear();
+    color.Print(is_background_color, entry.parameters);
+    return entry.parameters;
+  }
+
+ private:
+  struct Entry {
+    bool valid = false;
+    Color color;
+    std::string parameters;
+  };
+  Terminal::Color support_ = Terminal::Color::TrueColor;
+  std::array<std::array<Entry, 2>, 2> entries_;
+  std::array<size_t, 2> last_ = {0, 0};
+};
+
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
 void UpdatePixelStyle(const Screen* screen,
-                      std::stringstream& ss,
+                      std::string& output,
                       const Pixel& prev,
                       const Pixel& next) {
   // See https://gist.github.com/egmontkob/eb114294efbcd5adb1944c9f3cb5feda
   if (FTXUI_UNLIKELY(next.hyperlink != prev.hyperlink)) {
-    ss << "\x1B]8;;" << screen->Hyperlink(next.hyperlink) << "\x1B\\";
+    output += "\x1B]8;;";
+    output += screen->Hyperlink(next.hyperlink);
+    output += "\x1B\\";
   }
 
+  SGRWriter sgr(output);
+
   // Bold
   if (FTXUI_UNLIKELY((next.bold ^ prev.bold) | (next.dim ^ prev.dim))) {
-    // BOLD_AND_DIM_RESET:
-    ss << ((prev.bold && !next.bold) || (prev.dim && !next.dim) ? "\x1B[22m"
-                                                                : "");
-    ss << (next.bold ? "\x1B[1m" : "");  // BOLD_SET
-    ss << (next.dim ? "\x1B[2m" : "");   // DIM_SET
+    if ((prev.bold && !next.bold) || (prev.dim && !next.dim)) {
+      sgr.Add("22");  // BOLD_AND_DIM_RESET
+    }
+    if (next.bold) {
+      sgr.Add("1");  // BOLD_SET
+    }
+    if (next.dim) {
+      sgr.Add("2");  // DIM_SET
+    }
   }
 
   // Underline
   if (FTXUI_UNLIKELY(next.underlined != prev.underlined ||
                      next.underlined_double != prev.underlined_double)) {
-    ss << (next.underlined          ? "\x1B[4m"     // UNDERLINE
-           : next.underlined_double ? "\x1B[21m"    // UNDERLINE_DOUBLE
-                                    : "\x1B[24m");  // UNDERLINE_RESET
+    sgr.Add(next.underlined          ? "4"     // UNDERLINE
+            : next.underlined_double ? "21"    // UNDERLINE_DOUBLE
+                                     : "24");  // UNDERLINE_RESET
   }
 
   // Blink
   if (FTXUI_UNLIKELY(next.blink != prev.blink)) {
-    ss << (next.blink ? "\x1B[5m"     // BLINK_SET
-                      : "\x1B[25m");  // BLINK_RESET
+    sgr.Add(next.blink ? "5"     // BLINK_SET
+                       : "25");  // BLINK_RESET
   }
 
   // Inverted
   if (FTXUI_UNLIKELY(next.inverted != prev.inverted)) {
-    ss << (next.inverted ? "\x1B[7m"     // INVERTED_SET
-                         : "\x1B[27m");  // INVERTED_RESET
+    sgr.Add(next.inverted ? "7"     // INVERTED_SET
+                          : "27");  // INVERTED_RESET
   }
 
   // Italics
   if (FTXUI_UNLIKELY(next.italic != prev.italic)) {
-    ss << (next.italic ? "\x1B[3m"     // ITALIC_SET
-                       : "\x1B[23m");  // ITALIC_RESET
+    sgr.Add(next.italic ? "3"     // ITALIC_SET
+                        : "23");  // ITALIC_RESET
   }
 
   // StrikeThrough
   if (FTXUI_UNLIKELY(next.strikethrough != prev.strikethrough)) {
-    ss << (next.strikethrough ? "\x1B[9m"     // CROSSED_OUT
-                              : "\x1B[29m");  // CROSSED_OUT_RESET
+    sgr.Add(next.strikethrough ? "9"     // CROSSED_OUT
+                               : "29");  // CROSSED_OUT_RESET
   }
 
   if (FTXUI_UNLIKELY(next.foreground_color != prev.foreground_color ||
                      next.background_color != prev.background_color)) {
-    ss << "\x1B[" + next.foreground_color.Print(false) + "m";
-    ss << "\x1B[" + next.background_color.Print(true) + "m";
+    // One per thread, the rows may be encoded in parallel.
+    thread_local ColorPrinter printer;  // NOLINT
+    const std::string& prev_foreground =
+        printer.Print(prev.foreground_color, false);
+    const std::string& next_foreground =
+        printer.Print(next.foreground_color, false);
+    const std::string& prev_background =
+        printer.Print(prev.background_color, true);
+    const std::string& next_background =
+        printer.Print(next.background_color, true);
+    if (prev_foreground != next_foreground ||
+        prev_background != next_background) {
+      sgr.Add(next_foreground);
+      sgr.Add(next_background);
+    }
   }
 }
 
@@ -131,26 +265,10 @@ struct TileEncoding {
   std::uint8_t right : 2;
   std::uint8_t down : 2;
   std::uint8_t round : 1;
-
-  // clang-format off
-  bool operator<(const TileEncoding& other) const {
-    if (left < other.left)   { return  true;  }
-    if (left > other.left)   { return  false; }
-    if (top < other.top)     { return  true;  }
-    if (top > other.top)     { return  false; }
-    if (right < other.right) { return  true;  }
-    if (right > other.right) { return  false; }
-    if (down < other.down)   { return  true;  }
-    if (down > other.down)   { return  false; }
-    if (round < other.round) { return  true;  }
-    if (round > other.round) { return  false; }
-      return false;
-  }
-  // clang-format on
 };
 
 // clang-format off
-const std::map<std::string, TileEncoding> tile_encoding = { // NOLINT
+const std::pair<const char*, TileEncoding> tile_encoding[] = { // NOLINT
     {"─", {1, 0, 1, 0, 0}},
     {"━", {2, 0, 2, 0, 0}},
     {"╍", {2, 0, 2, 0, 0}},
@@ -293,78 +411,361 @@ const std::map<std::string, TileEncoding> tile_encoding = { // NOLINT
 };
 // clang-format on
 
-template <class A, class B>
-std::map<B, A> InvertMap(const std::map<A, B> input) {
-  std::map<B, A> output;
-  for (const auto& it : input) {
-    output[it.second] = it.first;
+// Box drawing characters are the 128 codepoints in between U+2500 and U+257F.
+// In UTF-8, they are encoded as E2 94 80..BF and E2 95 80..BF.
+constexpr int kTileCount = 128;
+constexpr int kNoTile = -1;
+
+// A TileEncoding packed into an integer: 2 bits per direction, and 1 bit for
+// the rounded corners.
+constexpr int kLeft = 0;
+constexpr int kTop = 2;
+constexpr int kRight = 4;
+constexpr int kDown = 6;
+constexpr int kPackedCount = 512;
+
+int Pack(const TileEncoding& encoding) {
+  return (encoding.left << kLeft) | (encoding.top << kTop) |
+         (encoding.right << kRight) | (encoding.down << kDown) |
+         (encoding.round << 8);  // NOLINT
+}
+
+int Get(int packed, int direction) {
+  return (packed >> direction) & 3;  // NOLINT
+}
+
+int Set(int packed, int direction, int value) {
+  return (packed & ~(3 << direction)) | (value << direction);  // NOLINT
+}
+
+// Return the index of the box drawing character in |glyph|, or kNoTile.
+int TileIndex(const Glyph& glyph) {
+  const std::string_view str = glyph.view();
+  if (str.size() != 3 || str[0] != '\xE2') {
+    return kNoTile;
   }
-  return output;
+  const auto b1 = static_cast<unsigned char>(str[1]);
+  const auto b2 = static_cast<unsigned char>(str[2]);
+  if ((b1 != 0x94 && b1 != 0x95) || (b2 & 0xC0) != 0x80) {  // NOLINT
+    return kNoTile;
+  }
+  return ((b1 - 0x94) << 6) | (b2 & 0x3F);  // NOLINT
+}
+
+// Constant tables replacing the lookups into |tile_encoding| and its inverse.
+struct TileTables {
+  // Tile index -> packed encoding, or kNoTile.
+  std::array<int, kTileCount> encode;
+  // Packed encoding -> tile index, or kNoTile.
+  std::array<int, kPackedCount> decode;
+  // Tile index -> glyph.
+  std::array<Glyph, kTileCount> glyph;
+};
+
+TileTables BuildTileTables() {
+  TileTables tables;
+  tables.encode.fill(kNoTile);
+  tables.decode.fill(kNoTile);
+  for (const auto& it : tile_encoding) {
+    const int index = TileIndex(Glyph(it.first));
+    tables.encode[index] = Pack(it.second);
+    tables.glyph[index] = Glyph(it.first);
+  }
+  // Some encodings have several characters, like "━" and "╍". Keep the one
+  // with the highest codepoint.
+  for (int index = 0; index < kTileCount; ++index) {
+    if (tables.encode[index] != kNoTile) {
+      tables.decode[tables.encode[index]] = index;
+    }
+  }
+  return tables;
 }
 
-const std::map<TileEncoding, std::string> tile_encoding_inverse =  // NOLINT
-    InvertMap(tile_encoding);
+const TileTables tile_tables = BuildTileTables();  // NOLINT
 
-void UpgradeLeftRight(std::string& left, std::string& right) {
-  const auto it_left = tile_encoding.find(left);
-  if (it_left == tile_encoding.end()) {
+void UpgradeLeftRight(Glyph& left, Glyph& right) {
+  const int index_left = TileIndex(left);
+  if (index_left == kNoTile) {
+    return;
+  }
+  const int index_right = TileIndex(right);
+  if (index_right == kNoTile) {
     return;
   }
-  const auto it_right = tile_encoding.find(right);
-  if (it_right == tile_encoding.end()) {
+  const int encoding_left = tile_tables.encode[index_left];
+  const int encoding_right = tile_tables.encode[index_right];
+  if (encoding_left == kNoTile || encoding_right == kNoTile) {
     return;
   }
 
-  if (it_left->second.right == 0 && it_right->second.left != 0) {
-    TileEncoding encoding_left = it_left->second;
-    encoding_left.right = it_right->second.left;
-    const auto it_left_upgrade = tile_encoding_inverse.find(encoding_left);
-    if (it_left_upgrade != tile_encoding_inverse.end()) {
-      left = it_left_upgrade->second;
+  const int left_right = Get(encoding_left, kRight);
+  const int right_left = Get(encoding_right, kLeft);
+
+  if (left_right == 0 && right_left != 0) {
+    const int upgrade =
+        tile_tables.decode[Set(encoding_left, kRight, right_left)];
+    if (upgrade != kNoTile) {
+      left = tile_tables.glyph[upgrade];
     }
   }
 
-  if (it_right->second.left == 0 && it_left->second.right != 0) {
-    TileEncoding encoding_right = it_right->second;
-    encoding_right.left = it_left->second.right;
-    const auto it_right_upgrade = tile_encoding_inverse.find(encoding_right);
-    if (it_right_upgrade != tile_encoding_inverse.end()) {
-      right = it_right_upgrade->second;
+  if (right_left == 0 && left_right != 0) {
+    const int upgrade =
+        tile_tables.decode[Set(encoding_right, kLeft, left_right)];
+    if (upgrade != kNoTile) {
+      right = tile_tables.glyph[upgrade];
     }
   }
 }
 
-void UpgradeTopDown(std::string& top, std::string& down) {
-  const auto it_top = tile_encoding.find(top);
-  if (it_top == tile_encoding.end()) {
+void UpgradeTopDown(Glyph& top, Glyph& down) {
+  const int index_top = TileIndex(top);
+  if (index_top == kNoTile) {
+    return;
+  }
+  const int index_down = TileIndex(down);
+  if (index_down == kNoTile) {
     return;
   }
-  const auto it_down = tile_encoding.find(down);
-  if (it_down == tile_encoding.end()) {
+  const int encoding_top = tile_tables.encode[index_top];
+  const int encoding_down = tile_tables.encode[index_down];
+  if (encoding_top == kNoTile || encoding_down == kNoTile) {
     return;
   }
 
-  if (it_top->second.down == 0 && it_down->second.top != 0) {
-    TileEncoding encoding_top = it_top->second;
-    encoding_top.down = it_down->second.top;
-    const auto it_top_down = tile_encoding_inverse.find(encoding_top);
-    if (it_top_down != tile_encoding_inverse.end()) {
-      top = it_top_down->second;
+  const int top_down = Get(encoding_top, kDown);
+  const int down_top = Get(encoding_down, kTop);
+
+  if (top_down == 0 && down_top != 0) {
+    const int upgrade = tile_tables.decode[Set(encoding_top, kDown, down_top)];
+    if (upgrade != kNoTile) {
+      top = tile_tables.glyph[upgrade];
+    }
+  }
+
+  if (down_top == 0 && top_down != 0) {
+    const int upgrade = tile_tables.decode[Set(encoding_down, kTop, top_down)];
+    if (upgrade != kNoTile) {
+      down = tile_tables.glyph[upgrade];
+    }
+  }
+}
+
+bool IsFullWidth(const Pixel& pixel) {
+  return pixel.character.width() == 2;
+}
+
+// Append the cells of |row| to |output|. |previous| is the last pixel printed,
+// whose style is active.
+void EncodeRow(const Screen* screen,
+               std::string& output,
+               ConstPixelSpan row,
+               const Pixel*& previous) {
+  // After printing a fullwith character, we need to skip the next cell.
+  bool previous_fullwidth = false;
+  for (const Pixel& pixel : row) {
+    if (!previous_fullwidth) {
+      UpdatePixelStyle(screen, output, *previous, pixel);
+      previous = &pixel;
+      if (pixel.character.empty()) {
+        output += ' ';
+      } else {
+        output += pixel.character.view();
+      }
+    }
+    previous_fullwidth = IsFullWidth(pixel);
+  }
+}
+
+// Append the rows in between |y_begin| and |y_end| (exclusive) to |output|.
+// Each range starts and ends with the default style, so the outputs of
+// consecutive ranges can be concatenated.
+void EncodeRows(const Screen* screen,
+                std::string& output,
+                const Pixel* pixels,
+                int dimx,
+                int y_begin,
+                int y_end) {
+  const Pixel default_pixel;
+  const Pixel* previous_pixel_ref = &default_pixel;
+
+  for (int y = y_begin; y < y_end; ++y) {
+    // New line in between two lines.
+    if (y != 0) {
+      UpdatePixelStyle(screen, output, *previous_pixel_ref, default_pixel);
+      previous_pixel_ref = &default_pixel;
+      output += "\r\n";
     }
+
+    const Pixel* line = pixels + size_t(y) * size_t(dimx);
+    EncodeRow(screen, output, ConstPixelSpan(line, size_t(dimx)),
+              previous_pixel_ref);
+  }
+
+  // Reset the style to default:
+  UpdatePixelStyle(screen, output, *previous_pixel_ref, default_pixel);
+}
+
+// Whether the two pixels would be displayed identically on the terminal.
+// Hyperlinks are compared by value, because their ids are only meaningful
+// relatively to the screen owning them.
+bool SamePixel(const Screen& a_screen,
+               const Pixel& a,
+               const Screen& b_screen,
+               const Pixel& b) {
+  if (a.character != b.character ||                //
+      a.foreground_color != b.foreground_color ||  //
+      a.background_color != b.background_color ||  //
+      a.blink != b.blink ||                        //
+      a.bold != b.bold ||                          //
+      a.dim != b.dim ||                            //
+      a.italic != b.italic ||                      //
+      a.inverted != b.inverted ||                  //
+      a.underlined != b.underlined ||              //
+      a.underlined_double != b.underlined_double ||
+      a.strikethrough != b.strikethrough) {
+    return false;
   }
+  if (FTXUI_LIKELY(a.hyperlink == 0 && b.hyperlink == 0)) {
+    return true;
+  }
+  // Screens sharing the same registry resolve equal ids to the same string.
+  const std::string& a_link = a_screen.Hyperlink(a.hyperlink);
+  const std::string& b_link = b_screen.Hyperlink(b.hyperlink);
+  return &a_link == &b_link || a_link == b_link;
+}
+
+// Moving the cursor costs a few bytes. Below this number of unchanged cells in
+// between two changed ones, it is cheaper to print them again.
+constexpr int kMaxReprintedCells = 4;
 
-  if (it_down->second.top == 0 && it_top->second.down != 0) {
-    TileEncoding encoding_down = it_down->second;
-    encoding_down.top = it_top->second.down;
-    const auto it_down_top = tile_encoding_inverse.find(encoding_down);
-    if (it_down_top != tile_encoding_inverse.end()) {
-      down = it_down_top->second;
+// Scrolling costs around 20 bytes. Below this number of rows it saves from
+// being printed again, it isn't used.
+constexpr int kMinScrolledRows = 2;
+
+// A hash of the characters and the attributes of a row. The colors are
+// ignored, so rows with the same hash must still be compared.
+uint64_t HashRow(const Pixel* line, int dimx) {
+  uint64_t hash = 14695981039346656037ULL;  // NOLINT
+  auto mix = [&](uint64_t value) {
+    hash = (hash ^ value) * 1099511628211ULL;  // NOLINT
+  };
+  for (const Pixel& pixel : ConstPixelSpan(line, size_t(dimx))) {
+    for (const char c : pixel.character.view()) {
+      mix(static_cast<unsigned char>(c));
     }
+    mix(uint64_t(pixel.blink) | uint64_t(pixel.bold) << 1U |
+        uint64_t(pixel.dim) << 2U | uint64_t(pixel.italic) << 3U |
+        uint64_t(pixel.inverted) << 4U | uint64_t(pixel.underlined) << 5U |
+        uint64_t(pixel.underlined_double) << 6U |
+        uint64_t(pixel.strikethrough) << 7U |
+        uint64_t(pixel.hyperlink) << 8U);  // NOLINT
   }
+  return hash;
 }
 
-bool ShouldAttemptAutoMerge(Pixel& pixel) {
-  return pixel.automerge && pixel.character.size() == 3;
+// The rows in between |top| and |bottom| (inclusive) are shifted up by |shift|
+// rows, or down when negative. The rows uncovered are blank.
+struct ScrollRegion {
+  int top = 0;
+  int bottom = 0;
+  int shift = 0;
+
+  // The row of the terminal displayed at |y| after scrolling, or -1 for a
+  // blank row.
+  int Source(int y) const {
+    if (shift == 0 || y < top || y > bottom) {
+      return y;
+    }
+    const int source = y + shift;
+    return (source < top || source > bottom) ? -1 : source;
+  }
+};
+
+// Find the scroll region making the most rows of |previous| match the rows of
+// |current|. Return a region with no shift when scrolling isn't worth it.
+ScrollRegion FindScrollRegion(const Screen& current_screen,
+                              const Pixel* current,
+                              int current_dimx,
+                              const Screen& previous_screen,
+                              const Pixel* previous,
+                              int previous_dimx,
+                              int dimx,
+                              int dimy) {
+  std::vector<uint64_t> current_hash(static_cast<size_t>(dimy));
+  std::vector<uint64_t> previous_hash(static_cast<size_t>(dimy));
+  for (int y = 0; y < dimy; ++y) {
+    current_hash[y] = HashRow(current + size_t(y) * current_dimx, dimx);
+    previous_hash[y] = HashRow(previous + size_t(y) * previous_dimx, dimx);
+  }
+  const std::vector<Pixel> blank(static_cast<size_t>(dimx));
+  const uint64_t blank_hash = HashRow(blank.data(), dimx);
+
+  // What turning the row |y| into a blank row gains, accumulated.
+  std::vector<int> blank_gain(size_t(dimy) + 1);
+  for (int y = 0; y < dimy; ++y) {
+    blank_gain[y + 1] = blank_gain[y] +
+                        int(current_hash[y] == blank_hash) -
+                        int(current_hash[y] == previous_hash[y]);
+  }
+
+  // Try every shift, and every run of rows matching once shifted.
+  ScrollRegion best;
+  int best_gain = kMinScrolledRows - 1;
+  for (int shift = 1 - dimy; shift < dimy; ++shift) {
+    if (shift == 0) {
+      continue;
+    }
+    const int y_begin = std::max(0, -shift);
+    const int y_end = std::min(dimy, dimy - shift);
+    int run_begin = y_begin;
+    int run_gain = 0;
+    for (int y = y_begin; y <= y_end; ++y) {
+      if (y < y_end && current_hash[y] == previous_hash[y + shift]) {
+        run_gain += int(current_hash[y] != previous_hash[y]);
+        continue;
+      }
+
+      // The run [run_begin, y) ends. The rows it uncovers become blank.
+      if (y > run_begin) {
+        ScrollRegion region;
+        region.shift = shift;
+        region.top = shift > 0 ? run_begin : run_begin + shift;
+        region.bottom = shift > 0 ? y - 1 + shift : y - 1;
+        const int blank_top = shift > 0 ? y : region.top;
+        const int blank_bottom = shift > 0 ? region.bottom : run_begin - 1;
+        const int gain =
+            run_gain + blank_gain[blank_bottom + 1] - blank_gain[blank_top];
+        if (gain > best_gain) {
+          best_gain = gain;
+          best = region;
+        }
+      }
+      run_begin = y + 1;
+      run_gain = 0;
+    }
+  }
+
+  if (best.shift == 0) {
+    return best;
+  }
+
+  // The hashes ignore the colors. Check the shifted rows really match.
+  for (int y = best.top; y <= best.bottom; ++y) {
+    const int source = best.Source(y);
+    if (source == -1) {
+      continue;
+    }
+    const Pixel* line = current + size_t(y) * current_dimx;
+    const Pixel* previous_line = previous + size_t(source) * previous_dimx;
+    for (int x = 0; x < dimx; ++x) {
+      if (!SamePixel(current_screen, line[x], previous_screen,
+                     previous_line[x])) {
+        return {};
+      }
+    }
+  }
+  return best;
 }
 
 }  // namespace
@@ -395,7 +796,42 @@ Screen Screen::Create(Dimensions dimension) {
   return {dimension.dimx, dimension.dimy};
 }
 
-Screen::Screen(int dimx, int dimy) : Image{dimx, dimy} {
+// The hyperlinks registered into a Screen. Registering a link is a hash
+// lookup. The links are never removed, but the whole registry is replaced by
+// Screen::Clear() when it gets too large.
+class Screen::HyperlinkRegistry {
+ public:
+  HyperlinkRegistry() { Register(""); }
+
+  uint16_t Register(const std::string& link) {
+    auto it = ids_.find(link);
+    if (it != ids_.end()) {
+      return it->second;
+    }
+    if (links_.size() > std::numeric_limits<uint16_t>::max()) {
+      return 0;
+    }
+    const auto id = static_cast<uint16_t>(links_.size());
+    links_.push_back(link);
+    ids_.emplace(links_.back(), id);
+    return id;
+  }
+
+  const std::string& Get(uint16_t id) const {
+    return id < links_.size() ? links_[id] : links_[0];
+  }
+
+  size_t size() const { return links_.size(); }
+
+ private:
+  // std::deque::push_back doesn't move the existing elements, so the keys of
+  // |ids_| remain valid.
+  std::deque<std::string> links_;
+  std::unordered_map<std::string_view, uint16_t> ids_;
+};
+
+Screen::Screen(int dimx, int dimy)
+    : Image{dimx, dimy}, hyperlinks_(std::make_shared<HyperlinkRegistry>()) {
 #if defined(_WIN32)
   // The placement of this call is a bit weird, however we can assume that
   // anybody who instantiates a Screen object eventually wants to output
@@ -413,44 +849,305 @@ Screen::Screen(int dimx, int dimy) : Image{dimx, dimy} {
 /// @note Don't forget to flush stdout. Alternatively, you can use
 /// Screen::Print();
 std::string Screen::ToString() const {
-  std::stringstream ss;
+  std::string output;
+  ToString(output);
+  return output;
+}
+
+/// Append to |output| the string that can be used to print the Screen on the
+/// terminal. Reusing the same |output| across frames avoids allocations.
+/// @param output The buffer to append to.
+/// @see ToString
+void Screen::ToString(std::string& output) const {
+  CommitCharacters();
+  // Most cells are printed using a single byte.
+  output.reserve(output.size() + (dimx_ + 2) * dimy_);
+  EncodeRows(this, output, pixels_.data(), dimx_, 0, dimy_);
+}
+
+/// Append to |output| the string that can be used to print the Screen on the
+/// terminal. The rows are split into contiguous ranges, encoded concurrently,
+/// and concatenated in order. The output is identical to ToString(output).
+/// This is only worth it for very large screens.
+/// @param output The buffer to append to.
+/// @param thread_count The maximum number of threads used, including the
+///                     calling one. 0 uses one per hardware core.
+/// @see ToString
+void Screen::ToStringParallel(std::string& output, int thread_count) const {
+  CommitCharacters();
+#if defined(__EMSCRIPTEN__)
+  thread_count = 1;
+#else
+  if (thread_count <= 0) {
+    thread_count = int(std::thread::hardware_concurrency());
+  }
+#endif
+  const int chunk_count = std::min(thread_count, dimy_);
+  if (chunk_count <= 1) {
+    ToString(output);
+    return;
+  }
+
+  // Resolve the lazily computed color support before the threads read it.
+  Terminal::ColorSupport();
+
+  std::vector<std::string> chunks(size_t(chunk_count - 1));
+  auto encode_chunk = [&](int i, std::string& chunk_output) {
+    const int y_begin = dimy_ * i / chunk_count;
+    const int y_end = dimy_ * (i + 1) / chunk_count;
+    chunk_output.reserve(chunk_output.size() +
+                         size_t(dimx_ + 2) * size_t(y_end - y_begin));
+    EncodeRows(this, chunk_output, pixels_.data(), dimx_, y_begin, y_end);
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(chunks.size());
+  for (int i = 1; i < chunk_count; ++i) {
+    threads.emplace_back(encode_chunk, i, std::ref(chunks[size_t(i - 1)]));
+  }
+
+  // The first chunk is encoded by the calling thread, directly into |output|.
+  encode_chunk(0, output);
+
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  for (const std::string& chunk : chunks) {
+    output += chunk;
+  }
+}
+
+/// Stream the string that can be used to print the Screen on the terminal into
+/// |sink|. This produces the same output as ToString(), but only a single row
+/// is held in memory at a time.
+/// @param sink The destination of the output.
+/// @see FileSink
+/// @see FileDescriptorSink
+void Screen::ToSink(const Sink& sink) const {
+  ToSink(Box{0, dimx_ - 1, 0, dimy_ - 1}, sink);
+}
+
+/// Stream the string that can be used to print a part of the Screen on the
+/// terminal into |sink|. Rows are separated by "\r\n".
+/// @param box The cells to print. It is clipped by the Screen dimensions.
+/// @param sink The destination of the output.
+void Screen::ToSink(const Box& box, const Sink& sink) const {
+  CommitCharacters();
+  const int x_min = std::max(box.x_min, 0);
+  const int x_max = std::min(box.x_max, dimx_ - 1);
+  const int y_min = std::max(box.y_min, 0);
+  const int y_max = std::min(box.y_max, dimy_ - 1);
+  if (x_min > x_max || y_min > y_max) {
+    return;
+  }
 
   const Pixel default_pixel;
   const Pixel* previous_pixel_ref = &default_pixel;
 
-  for (int y = 0; y < dimy_; ++y) {
+  // The buffer holding one row. It is reused for every row.
+  std::string output;
+  output.reserve(size_t(x_max - x_min + 3));
+
+  for (int y = y_min; y <= y_max; ++y) {
+    output.clear();
+
     // New line in between two lines.
-    if (y != 0) {
-      UpdatePixelStyle(this, ss, *previous_pixel_ref, default_pixel);
+    if (y != y_min) {
+      UpdatePixelStyle(this, output, *previous_pixel_ref, default_pixel);
       previous_pixel_ref = &default_pixel;
-      ss << "\r\n";
+      output += "\r\n";
+    }
+
+    const Pixel* line = pixels_.data() + size_t(y) * size_t(dimx_);
+    EncodeRow(this, output,
+              ConstPixelSpan(line + x_min, size_t(x_max - x_min + 1)),
+              previous_pixel_ref);
+
+    // Reset the style to default after the last row:
+    if (y == y_max) {
+      UpdatePixelStyle(this, output, *previous_pixel_ref, default_pixel);
+    }
+    sink(output);
+  }
+}
+
+/// @brief A Sink writing into a FILE*, like stdout or a file opened with
+/// fopen. The file isn't flushed.
+/// @param file The destination. It must outlive the Sink.
+Screen::Sink Screen::FileSink(std::FILE* file) {
+  return [file](std::string_view data) {
+    std::fwrite(data.data(), 1, data.size(), file);
+  };
+}
+
+/// @brief A Sink writing into a file descriptor, like a pipe or a file.
+/// @param fd The destination. It must outlive the Sink.
+Screen::Sink Screen::FileDescriptorSink(int fd) {
+  return [fd](std::string_view data) {
+    while (!data.empty()) {
+#if defined(_WIN32)
+      const int written = _write(fd, data.data(), unsigned(data.size()));
+#else
+      const auto written = ::write(fd, data.data(), data.size());
+#endif
+      if (written < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return;
+      }
+      data.remove_prefix(size_t(written));
     }
+  };
+}
+
+/// Produce a std::string updating the terminal from the content of |previous|
+/// to the content of this Screen. Only the cells that changed are printed.
+/// @param previous The Screen previously printed on the terminal. It must have
+///                 the same dimensions as this Screen.
+/// @note The cursor is expected to be at the top-left corner of the Screen. It
+/// is left at the beginning of the last line.
+/// @see ToString
+std::string Screen::ToStringDiff(const Screen& previous) const {
+  std::string output;
+  ToStringDiff(previous, output);
+  return output;
+}
+
+/// Append to |output| the string updating the terminal from the content of
+/// |previous| to the content of this Screen.
+/// @param previous The Screen previously printed on the terminal.
+/// @param output The buffer to append to.
+/// @see ToStringDiff
+void Screen::ToStringDiff(const Screen& previous,
+                          std::string& output,
+                          bool scroll) const {
+  CommitCharacters();
+  previous.CommitCharacters();
+  const Pixel default_pixel;
+  const Pixel* previous_pixel_ref = &default_pixel;
+  int cursor_y = 0;
+
+  const int dimx = std::min(dimx_, previous.dimx_);
+  const int dimy = std::min(dimy_, previous.dimy_);
+
+  // Move the rows shifted since the previous frame using a scroll region, so
+  // that they don't have to be printed again.
+  ScrollRegion region;
+  std::vector<Pixel> blank_line;
+  if (scroll && dimy > 1) {
+    region = FindScrollRegion(*this, pixels_.data(), dimx_, previous,
+                              previous.pixels_.data(), previous.dimx_, dimx,
+                              dimy);
+  }
+  if (region.shift != 0) {
+    blank_line.resize(size_t(dimx));
+    output += "\x1B[";  // SET_SCROLL_REGION
+    AppendNumber(output, region.top + 1);
+    output += ';';
+    AppendNumber(output, region.bottom + 1);
+    output += 'r';
+    output += "\x1B[";
+    AppendNumber(output, std::abs(region.shift));
+    output += region.shift > 0 ? 'S' : 'T';  // SCROLL_UP : SCROLL_DOWN
+    output += "\x1B[r";  // RESET_SCROLL_REGION, moving the cursor home.
+  }
 
-    // After printing a fullwith character, we need to skip the next cell.
-    bool previous_fullwidth = false;
-    for (const auto& pixel : pixels_[y]) {
-      if (!previous_fullwidth) {
-        UpdatePixelStyle(this, ss, *previous_pixel_ref, pixel);
+  for (int y = 0; y < dimy; ++y) {
+    const Pixel* line = pixels_.data() + size_t(y) * size_t(dimx_);
+    const int source = region.Source(y);
+    const Pixel* previous_line =
+        source == -1
+            ? blank_line.data()
+            : previous.pixels_.data() + size_t(source) * size_t(previous.dimx_);
+
+    // A cell must be printed again when its content changed, or when the
+    // fullwidth character on its left appeared or disappeared.
+    auto is_dirty = [&](int x) {
+      if (!SamePixel(*this, line[x], previous, previous_line[x])) {
+        return true;
+      }
+      return x != 0 &&
+             IsFullWidth(line[x - 1]) != IsFullWidth(previous_line[x - 1]);
+    };
+
+    int x = 0;
+    while (x < dimx) {
+      if (!is_dirty(x)) {
+        ++x;
+        continue;
+      }
+
+      // Find the end of the run of dirty cells, absorbing small gaps.
+      int end = x;
+      for (int next = x + 1; next < dimx && next - end <= kMaxReprintedCells;
+           ++next) {
+        if (is_dirty(next)) {
+          end = next;
+        }
+      }
+
+      // The second half of a fullwidth character can't be printed alone.
+      int start = x;
+      if (start != 0 && IsFullWidth(line[start - 1])) {
+        --start;
+      }
+
+      // Move the cursor to the beginning of the run.
+      if (y != cursor_y) {
+        output += "\x1B[";  // MOVE_DOWN
+        AppendNumber(output, y - cursor_y);
+        output += 'B';
+        cursor_y = y;
+      }
+      if (start == 0) {
+        output += '\r';  // MOVE_LEFT
+      } else {
+        output += "\x1B[";  // MOVE_TO_COLUMN
+        AppendNumber(output, start + 1);
+        output += 'G';
+      }
+
+      bool previous_fullwidth = false;
+      for (x = start; x <= end; ++x) {
+        if (previous_fullwidth) {
+          previous_fullwidth = false;
+          continue;
+        }
+        const Pixel& pixel = line[x];
+        UpdatePixelStyle(this, output, *previous_pixel_ref, pixel);
         previous_pixel_ref = &pixel;
         if (pixel.character.empty()) {
-          ss << " ";
+          output += ' ';
         } else {
-          ss << pixel.character;
+          output += pixel.character.view();
         }
+        previous_fullwidth = IsFullWidth(pixel);
+      }
+
+      // The fullwidth character printed last covers the next cell.
+      if (previous_fullwidth) {
+        ++x;
       }
-      previous_fullwidth = (string_width(pixel.character) == 2);
     }
   }
 
   // Reset the style to default:
-  UpdatePixelStyle(this, ss, *previous_pixel_ref, default_pixel);
+  UpdatePixelStyle(this, output, *previous_pixel_ref, default_pixel);
 
-  return ss.str();
+  // Move the cursor to the beginning of the last line:
+  if (dimy_ - 1 > cursor_y) {
+    output += "\x1B[";  // MOVE_DOWN
+    AppendNumber(output, dimy_ - 1 - cursor_y);
+    output += 'B';
+  }
+  output += '\r';  // MOVE_LEFT
 }
 
 // Print the Screen to the terminal.
 void Screen::Print() const {
-  std::cout << ToString() << '\0' << std::flush;
+  ToSink([](std::string_view data) { std::cout << data; });
+  std::cout << '\0' << std::flush;
 }
 
 /// @brief Return a string to be printed in order to reset the cursor position
@@ -473,21 +1170,21 @@ void Screen::Print() const {
 /// @return The string to print in order to reset the cursor position to the
 ///         beginning.
 std::string Screen::ResetPosition(bool clear) const {
-  std::stringstream ss;
+  std::string output;
   if (clear) {
-    ss << "\r";       // MOVE_LEFT;
-    ss << "\x1b[2K";  // CLEAR_SCREEN;
+    output += "\r";       // MOVE_LEFT;
+    output += "\x1b[2K";  // CLEAR_SCREEN;
     for (int y = 1; y < dimy_; ++y) {
-      ss << "\x1B[1A";  // MOVE_UP;
-      ss << "\x1B[2K";  // CLEAR_LINE;
+      output += "\x1B[1A";  // MOVE_UP;
+      output += "\x1B[2K";  // CLEAR_LINE;
     }
   } else {
-    ss << "\r";  // MOVE_LEFT;
+    output += "\r";  // MOVE_LEFT;
     for (int y = 1; y < dimy_; ++y) {
-      ss << "\x1B[1A";  // MOVE_UP;
+      output += "\x1B[1A";  // MOVE_UP;
     }
   }
-  return ss.str();
+  return output;
 }
 
 /// @brief Clear all the pixel from the screen.
@@ -497,31 +1194,39 @@ void Screen::Clear() {
   cursor_.x = dimx_ - 1;
   cursor_.y = dimy_ - 1;
 
-  hyperlinks_ = {
-      "",
-  };
+  // The hyperlinks are kept, so that the next frame finds them registered
+  // already. Start a new registry once half of the ids are used, so a frame
+  // never runs out of them. The copies of the screen keep the previous one.
+  if (hyperlinks_->size() > std::numeric_limits<uint16_t>::max() / 2) {
+    hyperlinks_ = std::make_shared<HyperlinkRegistry>();
+  }
 }
 
 // clang-format off
 void Screen::ApplyShader() {
-  // Merge box characters togethers.
+  CommitCharacters();
+  // Merge box characters togethers. The automerge bit can only be set through
+  // PixelAt() or RowAt(), so the rows never accessed since Clear() are skipped.
   for (int y = 0; y < dimy_; ++y) {
+    if (!modified_rows_[size_t(y)]) {
+      continue;
+    }
+    Pixel* line = pixels_.data() + size_t(y) * size_t(dimx_);
     for (int x = 0; x < dimx_; ++x) {
-      // Box drawing character uses exactly 3 byte.
-      Pixel& cur = pixels_[y][x];
-      if (!ShouldAttemptAutoMerge(cur)) {
+      Pixel& cur = line[x];
+      if (!cur.automerge) {
         continue;
       }
 
       if (x > 0) {
-        Pixel& left = pixels_[y][x-1];
-        if (ShouldAttemptAutoMerge(left)) {
+        Pixel& left = line[x - 1];
+        if (left.automerge) {
           UpgradeLeftRight(left.character, cur.character);
         }
       }
       if (y > 0) {
-        Pixel& top = pixels_[y-1][x];
-        if (ShouldAttemptAutoMerge(top)) {
+        Pixel& top = line[x - dimx_];
+        if (top.automerge) {
           UpgradeTopDown(top.character, cur.character);
         }
       }
@@ -530,24 +1235,17 @@ void Screen::ApplyShader() {
 }
 // clang-format on
 
-std::uint8_t Screen::RegisterHyperlink(const std::string& link) {
-  for (std::size_t i = 0; i < hyperlinks_.size(); ++i) {
-    if (hyperlinks_[i] == link) {
-      return i;
-    }
-  }
-  if (hyperlinks_.size() == std::numeric_limits<std::uint8_t>::max()) {
-    return 0;
-  }
-  hyperlinks_.push_back(link);
-  return hyperlinks_.size() - 1;
+/// @brief Register a hyperlink, and return its id. Registering the same link
+/// again returns the same id, including in the next frames.
+/// @param link The URL of the hyperlink.
+std::uint16_t Screen::RegisterHyperlink(const std::string& link) {
+  return hyperlinks_->Register(link);
 }
 
-const std::string& Screen::Hyperlink(std::uint8_t id) const {
-  if (id >= hyperlinks_.size()) {
-    return hyperlinks_[0];
-  }
-  return hyperlinks_[id];
+/// @brief Return the hyperlink registered with |id|, or an empty string.
+/// @param id The id returned by RegisterHyperlink.
+const std::string& Screen::Hyperlink(std::uint16_t id) const {
+  return hyperlinks_->Get(id);
 }
 
 /// @brief Return the current selection style.
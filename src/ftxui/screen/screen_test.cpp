@@ -0,0 +1,307 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/screen/screen.hpp"
+#include <gtest/gtest.h>
+#include <cstdio>       // for fclose, fread, rewind, tmpfile, FILE
+#include <string>       // for allocator, string
+#include <string_view>  // for string_view
+#include "ftxui/screen/box.hpp"
+#include "ftxui/screen/color.hpp"
+#include "ftxui/screen/terminal.hpp"
+
+namespace ftxui {
+
+TEST(ScreenTest, ToStringCombinedStyle) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  Screen screen(2, 1);
+  screen.at(0, 0) = "a";
+  screen.PixelAt(0, 0).bold = true;
+  screen.PixelAt(0, 0).underlined = true;
+  screen.PixelAt(0, 0).foreground_color = Color::RGB(1, 2, 3);
+  screen.at(1, 0) = "b";
+
+  EXPECT_EQ(screen.ToString(),
+            "\x1B[1;4;38;2;1;2;3;49m"
+            "a"
+            "\x1B[22;24;39;49m"
+            "b");
+}
+
+TEST(ScreenTest, ToStringGradientPalette256) {
+  // A gradient whose colors are all printed as the same palette color.
+  Terminal::SetColorSupport(Terminal::Color::Palette256);
+  Screen screen(4, 1);
+  for (int x = 0; x < 4; ++x) {
+    screen.at(x, 0) = "a";
+    screen.PixelAt(x, 0).foreground_color = Color::RGB(255 - x, 0, 0);
+  }
+  EXPECT_EQ(screen.ToString(),
+            "\x1B[38;5;196;49m"
+            "aaaa"
+            "\x1B[39;49m");
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+}
+
+TEST(ScreenTest, ToStringAppend) {
+  Screen screen(2, 2);
+  screen.at(0, 0) = "a";
+
+  std::string output = "prefix";
+  screen.ToString(output);
+  EXPECT_EQ(output, "prefixa \r\n  ");
+}
+
+TEST(ScreenTest, ToStringDiffUnchanged) {
+  Screen previous(3, 3);
+  Screen screen(3, 3);
+  previous.at(1, 1) = "a";
+  screen.at(1, 1) = "a";
+
+  // Only move the cursor to the beginning of the last line.
+  EXPECT_EQ(screen.ToStringDiff(previous), "\x1B[2B\r");
+}
+
+TEST(ScreenTest, ToStringDiffChangedCells) {
+  Screen previous(10, 3);
+  Screen screen(10, 3);
+  screen.at(0, 0) = "a";
+  screen.at(1, 0) = "b";
+  screen.at(8, 1) = "c";
+  screen.PixelAt(8, 1).bold = true;
+
+  EXPECT_EQ(screen.ToStringDiff(previous),
+            "\rab"              // First run, at the beginning of the line.
+            "\x1B[1B\x1B[9G"    // Move to the second run.
+            "\x1B[1mc\x1B[22m"  // Print it.
+            "\x1B[1B\r");       // Move to the last line.
+}
+
+TEST(ScreenTest, ToStringDiffSmallGap) {
+  Screen previous(10, 1);
+  Screen screen(10, 1);
+  screen.at(2, 0) = "a";
+  screen.at(5, 0) = "b";
+
+  // Reprinting the two unchanged cells is cheaper than moving the cursor.
+  EXPECT_EQ(screen.ToStringDiff(previous), "\x1B[3Ga  b\r");
+}
+
+TEST(ScreenTest, ToStringDiffFullWidth) {
+  Screen previous(4, 1);
+  Screen screen(4, 1);
+  previous.at(0, 0) = "测";
+  previous.at(1, 0) = "";
+  screen.at(0, 0) = "测";
+  screen.at(1, 0) = "";
+  screen.PixelAt(1, 0).bold = true;
+
+  // The fullwidth character must be printed again with its second half.
+  EXPECT_EQ(screen.ToStringDiff(previous), "\r测\r");
+
+  // The cell following a removed fullwidth character must be printed again.
+  screen.at(0, 0) = "a";
+  screen.PixelAt(1, 0).bold = false;
+  EXPECT_EQ(screen.ToStringDiff(previous), "\ra \r");
+}
+
+TEST(ScreenTest, ToStringDiffScrollUp) {
+  Screen previous(2, 5);
+  Screen screen(2, 5);
+  for (int y = 0; y < 5; ++y) {
+    previous.at(0, y) = std::string(1, char('a' + y));
+    screen.at(0, y) = std::string(1, char('a' + y + 1));
+  }
+
+  // Without scrolling, every row is printed again.
+  EXPECT_EQ(screen.ToStringDiff(previous),
+            "\rb\x1B[1B\rc\x1B[1B\rd\x1B[1B\re\x1B[1B\rf\r");
+
+  // With scrolling, only the uncovered row is printed.
+  std::string output;
+  screen.ToStringDiff(previous, output, /*scroll=*/true);
+  EXPECT_EQ(output, "\x1B[1;5r\x1B[1S\x1B[r\x1B[4B\rf\r");
+}
+
+TEST(ScreenTest, ToStringDiffScrollDownRegion) {
+  Screen previous(2, 6);
+  Screen screen(2, 6);
+  previous.at(0, 0) = "h";
+  screen.at(0, 0) = "h";
+  for (int y = 1; y < 5; ++y) {
+    previous.at(0, y) = std::string(1, char('a' + y));
+    screen.at(0, y) = std::string(1, char('a' + y - 1));
+  }
+  previous.at(0, 5) = "z";
+  screen.at(0, 5) = "z";
+
+  std::string output;
+  screen.ToStringDiff(previous, output, /*scroll=*/true);
+  EXPECT_EQ(output, "\x1B[2;5r\x1B[1T\x1B[r\x1B[1B\ra\x1B[4B\r");
+}
+
+TEST(ScreenTest, ToStringDiffScrollChecksColors) {
+  Screen previous(2, 4);
+  Screen screen(2, 4);
+  for (int y = 0; y < 4; ++y) {
+    previous.at(0, y) = std::string(1, char('a' + y));
+    screen.at(0, y) = std::string(1, char('a' + y + 1));
+  }
+  // The rows have the same characters, but not the same colors once shifted.
+  screen.PixelAt(0, 1).foreground_color = Color::Red;
+
+  std::string output;
+  screen.ToStringDiff(previous, output, /*scroll=*/true);
+  EXPECT_EQ(output, screen.ToStringDiff(previous));
+}
+
+TEST(ScreenTest, ApplyShaderMergesBoxCharacters) {
+  Screen screen(3, 3);
+  screen.at(0, 1) = "─";
+  screen.at(1, 1) = "─";
+  screen.at(2, 1) = "─";
+  screen.at(1, 0) = "│";
+  screen.at(1, 2) = "│";
+  for (int x = 0; x < 3; ++x) {
+    screen.PixelAt(x, 1).automerge = true;
+  }
+  screen.PixelAt(1, 0).automerge = true;
+  screen.PixelAt(1, 2).automerge = true;
+
+  screen.ApplyShader();
+  EXPECT_EQ(screen.at(1, 1), "┼");
+  EXPECT_EQ(screen.at(0, 1), "─");
+  EXPECT_EQ(screen.at(1, 0), "│");
+}
+
+TEST(ScreenTest, ApplyShaderHeavy) {
+  Screen screen(3, 1);
+  screen.at(0, 0) = "╸";
+  screen.at(1, 0) = "━";
+  screen.at(2, 0) = "╷";
+  for (int x = 0; x < 3; ++x) {
+    screen.PixelAt(x, 0).automerge = true;
+  }
+
+  screen.ApplyShader();
+  // "━" and "╍" share the same encoding. The highest codepoint is used.
+  EXPECT_EQ(screen.at(0, 0), "╍");
+  EXPECT_EQ(screen.at(1, 0), "━");
+  EXPECT_EQ(screen.at(2, 0), "┑");
+}
+
+TEST(ScreenTest, ApplyShaderPixelAutomerge) {
+  Screen screen(2, 2);
+  screen.at(0, 1) = "─";
+  screen.at(1, 1) = "│";
+  screen.PixelAt(0, 1).automerge = true;
+  screen.PixelAt(1, 1).automerge = true;
+  screen.ApplyShader();
+  EXPECT_EQ(screen.at(1, 1), "┤");
+
+  screen.Clear();
+  screen.at(0, 1) = "─";
+  screen.at(1, 1) = "│";
+  screen.PixelAt(1, 1).automerge = true;
+  screen.ApplyShader();
+  EXPECT_EQ(screen.at(1, 1), "│");
+}
+
+TEST(ScreenTest, ApplyShaderRowAt) {
+  // The rows modified through RowAt() are merged, like through PixelAt().
+  Screen screen(3, 2);
+  screen.Clear();
+  for (Pixel& pixel : screen.RowAt(1, 0, 2)) {
+    pixel.character = "─";
+    pixel.automerge = true;
+  }
+  for (Pixel& pixel : screen.RowAt(0, 1, 1)) {
+    pixel.character = "│";
+    pixel.automerge = true;
+  }
+  screen.ApplyShader();
+  EXPECT_EQ(screen.at(1, 1), "┴");
+  EXPECT_EQ(screen.at(1, 0), "│");
+}
+
+TEST(ScreenTest, ToSinkMatchesToString) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  Screen screen(3, 3);
+  screen.at(0, 0) = "a";
+  screen.at(1, 1) = "測";
+  screen.PixelAt(1, 1).bold = true;
+  screen.PixelAt(2, 2).foreground_color = Color::RGB(1, 2, 3);
+  screen.PixelAt(2, 2).hyperlink = screen.RegisterHyperlink("https://a.com");
+
+  std::string output;
+  int chunks = 0;
+  screen.ToSink([&](std::string_view data) {
+    output += data;
+    ++chunks;
+  });
+  EXPECT_EQ(output, screen.ToString());
+  EXPECT_EQ(chunks, 3);
+}
+
+TEST(ScreenTest, ToSinkBox) {
+  Screen screen(4, 4);
+  screen.at(1, 1) = "a";
+  screen.at(2, 1) = "b";
+  screen.at(1, 2) = "c";
+  screen.PixelAt(2, 2).bold = true;
+  screen.at(2, 2) = "d";
+
+  std::string output;
+  screen.ToSink(Box{1, 2, 1, 2},
+                [&](std::string_view data) { output += data; });
+  EXPECT_EQ(output, "ab\r\nc\x1B[1md\x1B[22m");
+
+  // The box is clipped by the screen.
+  output.clear();
+  screen.ToSink(Box{3, 10, 3, 10},
+                [&](std::string_view data) { output += data; });
+  EXPECT_EQ(output, " ");
+
+  output.clear();
+  screen.ToSink(Box{5, 10, 0, 3},
+                [&](std::string_view data) { output += data; });
+  EXPECT_EQ(output, "");
+}
+
+TEST(ScreenTest, FileSink) {
+  Screen screen(2, 2);
+  screen.at(0, 0) = "a";
+  screen.at(1, 1) = "b";
+
+  std::FILE* file = std::tmpfile();
+  ASSERT_NE(file, nullptr);
+  screen.ToSink(Screen::FileSink(file));
+
+  std::string output(64, '\0');
+  std::rewind(file);
+  output.resize(std::fread(output.data(), 1, output.size(), file));
+  std::fclose(file);
+  EXPECT_EQ(output, "a \r\n b");
+}
+
+TEST(ScreenTest, ToStringParallel) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  Screen screen(20, 100);
+  for (int y = 0; y < screen.dimy(); ++y) {
+    for (int x = 0; x < screen.dimx(); ++x) {
+      screen.at(x, y) = std::string(1, char('a' + (x + y) % 26));
+      screen.PixelAt(x, y).bold = (x / 3 + y) % 2;
+      screen.PixelAt(x, y).foreground_color = Color::RGB(x, y, 0);
+    }
+  }
+  screen.at(19, 99) = "測";
+
+  const std::string expected = screen.ToString();
+  for (int thread_count : {0, 1, 2, 3, 7, 100, 1000}) {
+    std::string output = "prefix";
+    screen.ToStringParallel(output, thread_count);
+    EXPECT_EQ(output, "prefix" + expected) << thread_count;
+  }
+}
+
+}  // namespace ftxui
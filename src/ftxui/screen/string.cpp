@@ -11,11 +11,12 @@
 
 #include "ftxui/screen/string.hpp"
 
-#include <array>    // for array
-#include <cstddef>  // for size_t
-#include <cstdint>  // for uint32_t, uint8_t, uint16_t, int32_t
-#include <string>   // for string, basic_string, wstring
-#include <tuple>    // for _Swallow_assign, ignore
+#include <algorithm>  // for copy
+#include <array>      // for array
+#include <cstddef>    // for size_t, ptrdiff_t
+#include <cstdint>    // for uint32_t, uint8_t, uint16_t, int32_t
+#include <string>     // for string, basic_string, wstring
+#include <tuple>      // for _Swallow_assign, ignore
 #include <vector>
 
 #include "ftxui/screen/deprecated.hpp"       // for wchar_width, wstring_width
@@ -1396,6 +1397,51 @@ std::vector<std::string> Utf8ToGlyphs(const std::string& input) {
   return out;
 }
 
+std::vector<uint32_t> Utf8ToGlyphEnds(std::string& input) {
+  std::vector<uint32_t> ends;
+  ends.reserve(input.size());
+  size_t write = 0;
+  size_t start = 0;
+  size_t end = 0;
+  while (start < input.size()) {
+    uint32_t codepoint = 0;
+    if (!EatCodePoint(input, start, &end, &codepoint)) {
+      start = end;
+      continue;
+    }
+
+    // Ignore control characters, and combining characters without a glyph
+    // to modify.
+    const bool combining = IsCombining(codepoint);
+    if (IsControl(codepoint) || (combining && ends.empty())) {
+      start = end;
+      continue;
+    }
+
+    // The kept bytes are moved toward the beginning, over the ignored ones.
+    std::copy(input.begin() + static_cast<std::ptrdiff_t>(start),
+              input.begin() + static_cast<std::ptrdiff_t>(end),
+              input.begin() + static_cast<std::ptrdiff_t>(write));
+    write += end - start;
+    start = end;
+
+    // Combining characters are put with the previous glyph they are modifying.
+    if (combining) {
+      ends.back() = static_cast<uint32_t>(write);
+      continue;
+    }
+
+    ends.push_back(static_cast<uint32_t>(write));
+
+    // Fullwidth characters take two cells. The second is empty.
+    if (IsFullWidth(codepoint)) {
+      ends.push_back(static_cast<uint32_t>(write));
+    }
+  }
+  input.resize(write);
+  return ends;
+}
+
 size_t GlyphPrevious(const std::string& input, size_t start) {
   while (true) {
     if (start == 0) {
@@ -35,6 +35,12 @@ size_t GlyphIterate(const std::string& input,
 // Returns the number of glyphs in |input|.
 int GlyphCount(const std::string& input);
 
+// Split |input| into the glyphs of its cells, like Utf8ToGlyphs, without
+// allocating a string per glyph. The ignored characters are removed from
+// |input|. Then, the cell |i| is made of the bytes [ends[i-1], ends[i]) of
+// |input|.
+std::vector<uint32_t> Utf8ToGlyphEnds(std::string& input);
+
 // Properties from:
 // https://www.unicode.org/Public/UCD/latest/ucd/auxiliary/WordBreakProperty.txt
 enum class WordBreakProperty : int8_t {
@@ -48,6 +48,38 @@ TEST(StringTest, Utf8ToGlyphs) {
   EXPECT_EQ(Utf8ToGlyphs("a\1a"), T({"a", "a"}));
 }
 
+TEST(StringTest, Utf8ToGlyphEnds) {
+  // The glyphs must match Utf8ToGlyphs.
+  auto glyphs = [](std::string input) {
+    const std::vector<uint32_t> ends = Utf8ToGlyphEnds(input);
+    std::vector<std::string> out;
+    uint32_t begin = 0;
+    for (const uint32_t end : ends) {
+      out.push_back(input.substr(begin, end - begin));
+      begin = end;
+    }
+    return out;
+  };
+  for (const std::string input : {
+           "",
+           "abc",
+           "测试",
+           "a̗b⃒",
+           "测̗a",
+           "\1a̗",
+           "̗a",
+           "a\1̗b",
+           "a\n\tb",
+       }) {
+    EXPECT_EQ(glyphs(input), Utf8ToGlyphs(input)) << input;
+  }
+
+  // The ignored characters are removed.
+  std::string input = "a\1b\2c";
+  EXPECT_EQ(Utf8ToGlyphEnds(input), std::vector<uint32_t>({1, 2, 3}));
+  EXPECT_EQ(input, "abc");
+}
+
 TEST(StringTest, GlyphCount) {
   // Basic:
   EXPECT_EQ(GlyphCount(""), 0);